@@ -0,0 +1,128 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+
+// Bridge egress path: sensor id naming, routing table lookups and payload serialization.
+// The nlohmann variant is the DOM based payload build the template serializer replaced.
+
+#include <cstdio>
+#include <string>
+
+#include <nlohmann/json.hpp>
+
+#include "harness.h"
+#include "payload_serializer.h"
+#include "routing_table.h"
+#include "sensors/sensors_data.h"
+
+
+namespace {
+    const nlohmann::json bridge_config = nlohmann::json::parse(R"({
+        "mqtt_topics": ["sensors/temperature", "sensors/speed"],
+        "routes": [
+            { "interface": "vcan0", "msg_id": "0x100", "topic": "sensors/{type}/{device}" },
+            { "interface": "vcan1", "msg_id": "0x300", "sensor_id": 2, "topic": "sensors/{interface}/{msg_id}" }
+        ]
+    })");
+
+    const RoutingTable& routing_table()
+    {
+        static RoutingTable table = [] {
+            RoutingTable t;
+            t.build(bridge_config, {"vcan0", "vcan1"});
+            return t;
+        }();
+        return table;
+    }
+}
+
+BENCHMARK(sensor_id_to_string)
+{
+    for (size_t i = 0; i < iterations; ++i) {
+        auto id = static_cast<SensorId>(i & 1 ? SensorId::Speed1 : SensorId::Temperature2);
+        bench::do_not_optimize(id);
+        std::string name = sensor_id_to_string(id);
+        bench::do_not_optimize(name);
+    }
+}
+
+BENCHMARK(routing_lookup_explicit)
+{
+    const auto& table = routing_table();
+    for (size_t i = 0; i < iterations; ++i) {
+        uint32_t can_id = 0x100;
+        bench::do_not_optimize(can_id);
+        const Route* route = table.lookup(0, can_id, static_cast<uint8_t>(SensorId::Temperature1));
+        bench::do_not_optimize(route);
+    }
+}
+
+BENCHMARK(routing_lookup_fallback)
+{
+    const auto& table = routing_table();
+    for (size_t i = 0; i < iterations; ++i) {
+        uint32_t can_id = 0x200;
+        bench::do_not_optimize(can_id);
+        const Route* route = table.lookup(0, can_id, static_cast<uint8_t>(SensorId::Speed1));
+        bench::do_not_optimize(route);
+    }
+}
+
+BENCHMARK(serialize_json_payload)
+{
+    const Route* route = routing_table().lookup(0, 0x200, static_cast<uint8_t>(SensorId::Speed1));
+    std::string payload;
+    float value = 12.345f;
+    for (size_t i = 0; i < iterations; ++i) {
+        bench::do_not_optimize(value);
+        serialize_json_payload(*route, value, payload);
+        bench::do_not_optimize(payload);
+    }
+}
+
+BENCHMARK(serialize_json_payload_nlohmann)
+{
+    float value = 12.345f;
+    for (size_t i = 0; i < iterations; ++i) {
+        bench::do_not_optimize(value);
+        char number[32];
+        std::snprintf(number, sizeof(number), "%.2f", value);
+        nlohmann::json j;
+        j["device"] = sensor_id_to_string(SensorId::Speed1);
+        j["unit"] = sensor_id_to_units(SensorId::Speed1);
+        j["value"] = number;
+        std::string payload = j.dump();
+        bench::do_not_optimize(payload);
+    }
+}
+
+BENCHMARK(serialize_packed_payload)
+{
+    std::string payload;
+    float value = 12.345f;
+    uint32_t sequence = 0;
+    for (size_t i = 0; i < iterations; ++i) {
+        bench::do_not_optimize(value);
+        serialize_packed_payload(static_cast<uint8_t>(SensorId::Speed1), value, 1700000000000000, sequence++, payload);
+        bench::do_not_optimize(payload);
+    }
+}
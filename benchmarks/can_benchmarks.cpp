@@ -0,0 +1,195 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+
+// CAN receive path: SocketCAN frame conversion done per frame in receive_loop,
+// the 5-byte SensorData record shared by producer and bridge, and DBC signal decoding and packing.
+
+#include <array>
+#include <cstring>
+
+#include <linux/can.h>
+
+#include "harness.h"
+#include "can/dbc/dbc_decoder.h"
+#include "can/dbc/dbc_encoder.h"
+#include "can/linux/sockets/can_frame_conversion.h"
+#include "sensors/sensors_data.h"
+
+
+namespace {
+    struct canfd_frame make_raw_frame(uint8_t len)
+    {
+        struct canfd_frame raw{};
+        raw.can_id = 0x100;
+        raw.len = len;
+        for (uint8_t i = 0; i < len; ++i) {
+            raw.data[i] = static_cast<uint8_t>(i * 7);
+        }
+        return raw;
+    }
+
+    // Eight signals of mixed width and byte order in one classic frame
+    constexpr const char* bench_dbc = R"(
+BO_ 256 Powertrain: 8 ECU
+ SG_ EngineSpeed : 0|16@1+ (0.25,0) [0|16383.75] "rpm" BRIDGE
+ SG_ Throttle : 16|8@1+ (0.4,0) [0|102] "%" BRIDGE
+ SG_ CoolantTemp : 24|8@1+ (1,-40) [-40|215] "degC" BRIDGE
+ SG_ Torque : 39|12@0- (0.5,0) [-1024|1023.5] "Nm" BRIDGE
+ SG_ Gear : 43|4@1+ (1,0) [0|15] "" BRIDGE
+ SG_ Brake : 48|1@1+ (1,0) [0|1] "" BRIDGE
+ SG_ Clutch : 49|1@1+ (1,0) [0|1] "" BRIDGE
+ SG_ Counter : 60|4@1+ (1,0) [0|15] "" BRIDGE
+)";
+}
+
+BENCHMARK(from_linux_frame_classic)
+{
+    const auto raw = make_raw_frame(8);
+    CanFrame frame;
+    for (size_t i = 0; i < iterations; ++i) {
+        bench::do_not_optimize(raw);
+        bool ok = from_linux_frame(raw, CAN_MTU, frame);
+        bench::do_not_optimize(ok);
+        bench::do_not_optimize(frame);
+    }
+}
+
+BENCHMARK(from_linux_frame_fd64)
+{
+    const auto raw = make_raw_frame(64);
+    CanFrame frame;
+    for (size_t i = 0; i < iterations; ++i) {
+        bench::do_not_optimize(raw);
+        bool ok = from_linux_frame(raw, CANFD_MTU, frame);
+        bench::do_not_optimize(ok);
+        bench::do_not_optimize(frame);
+    }
+}
+
+BENCHMARK(to_linux_frame_classic)
+{
+    CanFrame frame;
+    frame.id = 0x100;
+    frame.len = 8;
+    struct canfd_frame raw{};
+    for (size_t i = 0; i < iterations; ++i) {
+        bench::do_not_optimize(frame);
+        size_t mtu = to_linux_frame(frame, raw);
+        bench::do_not_optimize(mtu);
+        bench::do_not_optimize(raw);
+    }
+}
+
+BENCHMARK(to_linux_frame_fd64)
+{
+    CanFrame frame;
+    frame.id = 0x100;
+    frame.len = 64;
+    frame.is_fd = true;
+    struct canfd_frame raw{};
+    for (size_t i = 0; i < iterations; ++i) {
+        bench::do_not_optimize(frame);
+        size_t mtu = to_linux_frame(frame, raw);
+        bench::do_not_optimize(mtu);
+        bench::do_not_optimize(raw);
+    }
+}
+
+BENCHMARK(encode_sensor_data)
+{
+    SensorData data{static_cast<uint8_t>(SensorId::Temperature1), 23.45f};
+    uint8_t out[sensor_data_wire_size];
+    for (size_t i = 0; i < iterations; ++i) {
+        bench::do_not_optimize(data);
+        encode_sensor_data(data, out);
+        bench::do_not_optimize(out);
+    }
+}
+
+BENCHMARK(decode_sensor_data)
+{
+    uint8_t in[sensor_data_wire_size];
+    encode_sensor_data({static_cast<uint8_t>(SensorId::Speed1), 88.5f}, in);
+    for (size_t i = 0; i < iterations; ++i) {
+        bench::do_not_optimize(in);
+        SensorData data = decode_sensor_data(in);
+        bench::do_not_optimize(data);
+    }
+}
+
+BENCHMARK(decode_fd_frame_12_readings)
+{
+    // What the bridge does for a full FD frame: walk the 5-byte records until padding
+    CanFrame frame;
+    frame.is_fd = true;
+    frame.len = 64;
+    for (size_t r = 0; r < 12; ++r) {
+        encode_sensor_data({static_cast<uint8_t>(SensorId::Temperature1), static_cast<float>(r)}, frame.data.data() + r * sensor_data_wire_size);
+    }
+
+    for (size_t i = 0; i < iterations; ++i) {
+        bench::do_not_optimize(frame);
+        float sum = 0.0f;
+        for (size_t offset = 0; offset + sensor_data_wire_size <= frame.size(); offset += sensor_data_wire_size) {
+            SensorData data = decode_sensor_data(frame.data.data() + offset);
+            if (static_cast<SensorId>(data.sensor_id) == SensorId::Unknown) {
+                break;
+            }
+            sum += data.value;
+        }
+        bench::do_not_optimize(sum);
+    }
+}
+
+BENCHMARK(dbc_decode_classic_8_signals)
+{
+    const DbcDecoder decoder(*parse_dbc(bench_dbc));
+    CanFrame frame;
+    frame.id = 0x100;
+    frame.len = 8;
+    for (size_t b = 0; b < frame.len; ++b) {
+        frame.data[b] = static_cast<uint8_t>(b * 37 + 11);
+    }
+
+    std::array<DbcDecoder::Value, 8> values;
+    for (size_t i = 0; i < iterations; ++i) {
+        bench::do_not_optimize(frame);
+        const auto* message = decoder.find(frame);
+        size_t count = message ? decoder.decode(*message, frame, values.data()) : 0;
+        bench::do_not_optimize(count);
+        bench::do_not_optimize(values);
+    }
+}
+
+BENCHMARK(dbc_encode_classic_8_signals)
+{
+    const auto database = parse_dbc(bench_dbc);
+    const DbcEncoder encoder(database->messages.front());
+    const std::array<double, 8> values{3250.5, 42.4, 90.0, -120.5, 4.0, 1.0, 0.0, 7.0};
+    CanFrame frame;
+    for (size_t i = 0; i < iterations; ++i) {
+        bench::do_not_optimize(values);
+        encoder.encode(values, 0, frame);
+        bench::do_not_optimize(frame);
+    }
+}
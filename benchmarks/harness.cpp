@@ -0,0 +1,189 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+
+#include "harness.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <new>
+#include <string_view>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "logging/logger.h"
+
+
+// Every heap allocation in the process goes through these, the runner reads the
+// counters before and after the measured run
+namespace {
+    std::atomic<uint64_t> allocation_count{0};
+    std::atomic<uint64_t> allocation_bytes{0};
+
+    void* counted_alloc(size_t size, size_t alignment = 0)
+    {
+        allocation_count.fetch_add(1, std::memory_order_relaxed);
+        allocation_bytes.fetch_add(size, std::memory_order_relaxed);
+
+        void* p = alignment > alignof(std::max_align_t)
+            ? std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment)
+            : std::malloc(size ? size : 1);
+        if (!p) {
+            throw std::bad_alloc();
+        }
+        return p;
+    }
+}
+
+void* operator new(size_t size) { return counted_alloc(size); }
+void* operator new[](size_t size) { return counted_alloc(size); }
+void* operator new(size_t size, std::align_val_t al) { return counted_alloc(size, static_cast<size_t>(al)); }
+void* operator new[](size_t size, std::align_val_t al) { return counted_alloc(size, static_cast<size_t>(al)); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept
+{
+    try { return counted_alloc(size); } catch (...) { return nullptr; }
+}
+void* operator new[](size_t size, const std::nothrow_t&) noexcept
+{
+    try { return counted_alloc(size); } catch (...) { return nullptr; }
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+void operator delete[](void* p, size_t) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, size_t, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, size_t, std::align_val_t) noexcept { std::free(p); }
+
+namespace {
+    struct Benchmark {
+        std::string name;
+        bench::Function fn;
+    };
+
+    struct Result {
+        std::string name;
+        uint64_t iterations;
+        double ns_per_op;
+        double allocs_per_op;
+        double bytes_per_op;
+    };
+
+    std::vector<Benchmark>& benchmarks()
+    {
+        static std::vector<Benchmark> list;
+        return list;
+    }
+
+    Result run(const Benchmark& b, std::chrono::nanoseconds min_time)
+    {
+        using Clock = std::chrono::steady_clock;
+
+        // Grow the iteration count until one run is long enough to time reliably
+        size_t iterations = 1;
+        while (true) {
+            const uint64_t allocs_before = allocation_count.load();
+            const uint64_t bytes_before = allocation_bytes.load();
+            const auto start = Clock::now();
+            b.fn(iterations);
+            const auto elapsed = Clock::now() - start;
+            const uint64_t allocs = allocation_count.load() - allocs_before;
+            const uint64_t bytes = allocation_bytes.load() - bytes_before;
+
+            if (elapsed >= min_time || iterations >= (size_t{1} << 40)) {
+                const double n = static_cast<double>(iterations);
+                return {b.name, iterations, std::chrono::duration<double, std::nano>(elapsed).count() / n,
+                        static_cast<double>(allocs) / n, static_cast<double>(bytes) / n};
+            }
+
+            // Aim past the target from the last timing, at most 10x per step
+            const double scale = elapsed.count() > 0
+                ? 1.4 * static_cast<double>(min_time.count()) / static_cast<double>(elapsed.count())
+                : 10.0;
+            iterations = static_cast<size_t>(static_cast<double>(iterations) * std::clamp(scale, 2.0, 10.0));
+        }
+    }
+
+    void usage(const char* argv0)
+    {
+        std::fprintf(stderr, "Usage: %s [--filter SUBSTRING] [--min-time-ms N] [--json FILE]\n", argv0);
+    }
+}
+
+bench::Registrar::Registrar(const char* name, Function fn)
+{
+    benchmarks().push_back({name, std::move(fn)});
+}
+
+int main(int argc, char* argv[])
+{
+    std::string_view filter;
+    std::string json_file;
+    auto min_time = std::chrono::milliseconds(200);
+
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg = argv[i];
+        if (arg == "--filter" && i + 1 < argc) {
+            filter = argv[++i];
+        } else if (arg == "--min-time-ms" && i + 1 < argc) {
+            min_time = std::chrono::milliseconds(std::atoi(argv[++i]));
+        } else if (arg == "--json" && i + 1 < argc) {
+            json_file = argv[++i];
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    // Setup code of the benchmarks logs at info, keep it out of the result table
+    Logger::instance().set_level(LogLevel::Warn);
+
+    std::vector<Result> results;
+    std::printf("%-40s %14s %12s %12s %12s\n", "benchmark", "iterations", "ns/op", "allocs/op", "bytes/op");
+    for (const auto& b : benchmarks()) {
+        if (!filter.empty() && b.name.find(filter) == std::string::npos) {
+            continue;
+        }
+        const Result r = run(b, min_time);
+        std::printf("%-40s %14llu %12.2f %12.2f %12.1f\n", r.name.c_str(), static_cast<unsigned long long>(r.iterations),
+                    r.ns_per_op, r.allocs_per_op, r.bytes_per_op);
+        results.push_back(r);
+    }
+
+    // Machine readable results for comparing runs in CI
+    if (!json_file.empty()) {
+        auto out = nlohmann::json::array();
+        for (const auto& r : results) {
+            out.push_back({{"name", r.name}, {"iterations", r.iterations}, {"ns_per_op", r.ns_per_op},
+                           {"allocs_per_op", r.allocs_per_op}, {"bytes_per_op", r.bytes_per_op}});
+        }
+        std::ofstream file(json_file);
+        file << out.dump(2) << "\n";
+    }
+    return 0;
+}
@@ -0,0 +1,63 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string>
+
+
+// Minimal microbenchmark harness. A benchmark is a function that runs its body `iterations`
+// times; the runner grows the count until a run takes at least the minimum time and reports
+// ns/op plus heap allocations and bytes per op, counted by the replaced global operator new.
+//
+//   BENCHMARK(encode_sensor_data)
+//   {
+//       for (size_t i = 0; i < iterations; ++i) { ... bench::do_not_optimize(result); }
+//   }
+namespace bench {
+
+    using Function = std::function<void(size_t iterations)>;
+
+    struct Registrar {
+        Registrar(const char* name, Function fn);
+    };
+
+    // Keeps the compiler from discarding `value` or hoisting its computation out of the loop
+    template<typename T>
+    inline void do_not_optimize(const T& value)
+    {
+        asm volatile("" : : "r,m"(value) : "memory");
+    }
+
+    inline void clobber_memory()
+    {
+        asm volatile("" : : : "memory");
+    }
+}
+
+#define BENCHMARK(name) \
+    static void bench_##name(size_t iterations); \
+    static const bench::Registrar registrar_##name(#name, bench_##name); \
+    static void bench_##name([[maybe_unused]] size_t iterations)
@@ -0,0 +1,66 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+
+// Producer scheduling: the timer wheel behind TimerScheduler, per periodic task run
+// (expire on advance, re-insert at the next deadline).
+
+#include <vector>
+
+#include "harness.h"
+#include "scheduling/timer_wheel.h"
+
+
+namespace {
+    // `tasks` periodic timers with periods spread over 1..`max_period` ticks
+    void run_wheel(size_t iterations, size_t tasks, uint64_t max_period)
+    {
+        TimerWheel wheel;
+        std::vector<uint64_t> periods(tasks);
+        for (size_t id = 0; id < tasks; ++id) {
+            periods[id] = 1 + (id * 7919) % max_period;
+            wheel.insert(id, periods[id]);
+        }
+
+        std::vector<uint64_t> expired;
+        size_t runs = 0;
+        while (runs < iterations) {
+            wheel.advance(expired);
+            for (uint64_t id : expired) {
+                wheel.insert(id, wheel.now() + periods[id]);
+            }
+            runs += expired.size();
+            expired.clear();
+        }
+        bench::do_not_optimize(wheel);
+    }
+}
+
+BENCHMARK(timer_wheel_1k_tasks_short_periods)
+{
+    run_wheel(iterations, 1000, 200);
+}
+
+BENCHMARK(timer_wheel_10k_tasks_cascading)
+{
+    run_wheel(iterations, 10000, 50000);
+}
@@ -23,59 +23,108 @@
 
 #include "bridge.h"
 
-#include <iostream>
 #include <csignal>
-#include <format>
+#include <algorithm>
+#include <thread>
 
 #include "config/config_parser.h"
+#include "logging/logger.h"
+#ifdef HAVE_LIBURING
+#include "can/linux/io_uring/can_receiver.h"
+#endif
+#include "last_value_cache.h"
+#include "payload_serializer.h"
 #include "sensors/sensors_data.h"
 
 
-Bridge::Bridge() {
+static LogModule log_module("bridge");
+
+namespace {
+    // Hex CAN ID or mask as written in config.json, e.g. "0x7FF"
+    std::optional<uint32_t> parse_can_id(const nlohmann::json& value)
+    {
+        if (!value.is_string()) {
+            return std::nullopt;
+        }
+        return ::parse_can_id(value.get_ref<const std::string&>());
+    }
+}
+
+Bridge::Bridge()
+    : suppressed_(MetricsRegistry::instance().counter("bridge_readings_suppressed_total", "Readings inside the last-value deadband"))
+{
     signal(SIGTERM, Bridge::signal_handler);  // Handle service stop signal
     signal(SIGINT, Bridge::signal_handler);   // Handle Ctrl+C in terminal
+    signal(SIGHUP, Bridge::signal_handler);   // Reload CAN filters and log levels from config
 }
 
 bool Bridge::initialize(int argc, char* argv[])
 {
+    argc_ = argc;
+    argv_ = argv;
+
     auto config_opt = load_config(argc, argv);
     if (!config_opt) {
-        std::cerr << "Failed to load configuration" << std::endl;
+        LOG_ERROR(log_module, "Failed to load configuration");
         return false;
     }
     config_ = *config_opt;
 
     if (!config_.contains("can_interfaces") || !config_.contains("bridge") || !config_["bridge"].contains("mqtt_broker") || !config_["bridge"].contains("mqtt_port") || !config_["bridge"].contains("mqtt_topics")) {
-        std::cerr << "Invalid config file structure" << std::endl;
+        LOG_ERROR(log_module, "Invalid config file structure");
         return false;
     }
+
+    if (config_["bridge"].contains("logging")) {
+        Logger::instance().configure(config_["bridge"]["logging"]);
+    }
     return true;
 }
 
 bool Bridge::start()
 {
-    if (!connect_mqtt()) {
-        return false;
-    }
-
-    if (!setup_can_readers()) {
-        return false;
+    if (connect_mqtt() && setup_can_readers() && start_egress() && start_metrics()) {
+        return true;
     }
 
-    return true;
+    // Forwarder, receive and egress threads may already run, they must be joined before the Bridge goes away
+    shutdown_ingress();
+    stop();
+    return false;
 }
 
 void Bridge::stop()
 {
-    if (client_) {
+    // Final snapshot goes out before the publisher drains
+    if (metrics_exporter_) {
+        metrics_exporter_->stop();
+    }
+
+    if (forwarder_) {
+        forwarder_->stop();
+    }
+
+    if (publisher_) {
+        if (!publisher_->flush(std::chrono::seconds(5))) {
+            LOG_WARN(log_module, "Timed out waiting for {} MQTT messages", publisher_->in_flight());
+        }
+        LOG_INFO(log_module, "MQTT messages acked: {}, failed: {}", publisher_->acked(), publisher_->failed());
+    }
+
+    if (client_ && client_->is_connected()) {
         try {
             client_->disconnect()->wait();
-            std::cout << "Disconnected from broker" << std::endl;
+            LOG_INFO(log_module, "Disconnected from broker");
         }
         catch (const mqtt::exception& e) {
-            std::cerr << "MQTT Error during disconnect: " << e.what() << std::endl;
+            LOG_ERROR(log_module, "MQTT Error during disconnect: {}", e.what());
         }
     }
+
+    // Last, deliveries failed by the disconnect still go to the spool
+    if (forwarder_) {
+        forwarder_->close();
+    }
 }
 
 
@@ -83,117 +132,598 @@ bool Bridge::connect_mqtt()
 {
     const std::string mgtt_broker = config_["bridge"]["mqtt_broker"];
     const int mqtt_port = config_["bridge"]["mqtt_port"];
-    mqtt_topics_ = config_["bridge"]["mqtt_topics"];
     const std::string server_address = "mqtt://" + mgtt_broker + ":" + std::to_string(mqtt_port);
 
     client_ = std::make_unique<mqtt::async_client>(server_address, "bridge_client_1");
     
+    MqttPublisher::Options publisher_options;
+    publisher_options.max_in_flight = config_["bridge"].value("mqtt_max_in_flight", publisher_options.max_in_flight);
+
     mqtt::connect_options conn_opts;
     conn_opts.set_clean_session(true);
-    try
-    {
-        client_->connect(conn_opts)->wait();
-        std::cout << "Connected to broker" << std::endl;
+    conn_opts.set_max_inflight(static_cast<int>(publisher_options.max_in_flight));
+    conn_opts.set_connect_timeout(std::chrono::seconds(5));
+
+    publisher_ = std::make_unique<MqttPublisher>(*client_, publisher_options);
+    LOG_INFO(log_module, "MQTT in-flight window: {} messages", publisher_options.max_in_flight);
+
+    // Optional: "bridge": { "store_and_forward": { "directory": "/var/lib/can_mqtt_ipc/spool", "max_mb": 1024, "drain_rate": 500 } }
+    // An unreachable broker does not stop the bridge from starting, the forwarder keeps retrying
+    const auto forward_options = StoreAndForward::parse_options(config_["bridge"].value("store_and_forward", nlohmann::json::object()));
+    forwarder_ = std::make_unique<StoreAndForward>(*client_, conn_opts, *publisher_, forward_options);
+    return forwarder_->start();
+}
+
+bool Bridge::setup_can_readers()
+{
+    // Optional: "bridge": { "pipeline": { "ring_capacity": 4096, "overflow_policy": "drop_oldest", "egress_threads": 1 } }
+    const auto pipeline = config_["bridge"].value("pipeline", nlohmann::json::object());
+    const size_t ring_capacity = pipeline.value("ring_capacity", size_t{4096});
+    const std::string policy_name = pipeline.value("overflow_policy", std::string("block"));
+
+    OverflowPolicy policy = OverflowPolicy::Block;
+    if (policy_name == "drop_oldest") {
+        policy = OverflowPolicy::DropOldest;
+    } else if (policy_name == "drop_newest") {
+        policy = OverflowPolicy::DropNewest;
+    } else if (policy_name != "block") {
+        LOG_ERROR(log_module, "Unknown overflow_policy: {}", policy_name);
+        return false;
     }
-    catch (const mqtt::exception& e)
-    {
-        std::cerr << "MQTT Error: " << e.what() << std::endl;
+
+    // Routes are resolved once here, the egress threads only look them up
+    const auto interfaces = config_["can_interfaces"].get<std::vector<std::string>>();
+    std::vector<const DbcDecoder*> decoders;
+    if (!load_dbc_decoders(interfaces, decoders)) {
         return false;
     }
+    if (!routing_.build(config_["bridge"], interfaces, decoders)) {
+        LOG_ERROR(log_module, "Failed to build MQTT routing table");
+        return false;
+    }
+
+    // Optional: "bridge": { "can_backend": "epoll", "reactor_threads": 1 }
+    const std::string backend = config_["bridge"].value("can_backend", std::string("threads"));
+    if (backend == "epoll") {
+        reactor_ = std::make_shared<EpollReactor>(config_["bridge"].value("reactor_threads", size_t{1}));
+        if (!reactor_->start()) {
+            LOG_ERROR(log_module, "Failed to start the epoll reactor");
+            return false;
+        }
+    } else if (backend != "threads" && backend != "io_uring") {
+        LOG_ERROR(log_module, "Unknown can_backend: {}", backend);
+        return false;
+    }
+
+    // Optional: "bridge": { "capture": { "directory": "/var/lib/can_mqtt_ipc/captures", "segment_mb": 64 } }
+    if (config_["bridge"].contains("capture")) {
+        auto options = CaptureRecorder::parse_options(config_["bridge"]["capture"]);
+        if (options.enabled()) {
+            recorder_ = std::make_unique<CaptureRecorder>(std::move(options));
+            if (!recorder_->start()) {
+                LOG_ERROR(log_module, "Failed to start the capture recorder");
+                return false;
+            }
+        }
+    }
+
+    // Set up CAN readers for each unique CAN interface in the bindings
+    for(const auto& can_interface  : interfaces) {
+        LOG_INFO(log_module, "Setting up CAN interface: {}", can_interface);
+        auto receiver = make_receiver(can_interface, backend);
+        if (!receiver) {
+            return false;
+        }
+        can_receivers_[can_interface] = receiver;
+        if (recorder_ && !recorder_->add(*can_receivers_[can_interface])) {
+            LOG_ERROR(log_module, "Failed to record {}", can_interface);
+            return false;
+        }
+
+        const MetricLabels labels{{"interface", can_interface}};
+        auto& registry = MetricsRegistry::instance();
+        auto stage = std::make_unique<IngressStage>();
+        stage->decode_failures = &registry.counter("bridge_decode_failures_total", "CAN frames too short to hold a reading", labels);
+        stage->unknown_sensors = &registry.counter("bridge_unknown_sensor_total", "Readings without an MQTT route", labels);
+        stage->ring_dropped = &registry.counter("bridge_ring_dropped_total", "Readings dropped on ingress ring overflow", labels);
+        stage->ring_depth = &registry.gauge("bridge_ring_depth", "Readings queued between receive and egress", labels);
+        stage->kernel_to_callback = &registry.histogram("bridge_kernel_to_callback_seconds",
+            "Time from kernel frame reception to the receive callback", labels, 1e-6);
+        stage->trace_transit = &registry.histogram("bridge_trace_transit_seconds",
+            "Time from producer send to bridge reception of trace frames", labels, 1e-6);
+        stage->trace_lost = &registry.counter("bridge_trace_lost_total", "Trace frames missing from the sequence", labels);
+        stage->index = stages_.size();
+        stage->can_interface = can_interface;
+
+        // Optional: "bridge": { "interfaces": { "vcan0": { "trace_id": "0x7F0" } } }, same as producer.trace.msg_id
+        const auto interface_config = config_["bridge"].value("interfaces", nlohmann::json::object()).value(can_interface, nlohmann::json::object());
+        if (interface_config.contains("trace_id")) {
+            stage->trace_id = parse_can_id(interface_config["trace_id"]);
+            if (!stage->trace_id) {
+                LOG_ERROR(log_module, "{}: invalid trace_id {}", can_interface, interface_config["trace_id"].dump());
+                return false;
+            }
+        }
+        stage->ring = std::make_unique<SpscRing<SensorRecord>>(ring_capacity, policy);
+        stage->dbc = decoders[stage->index];
+        if (stage->dbc) {
+            stage->dbc_values.resize(stage->dbc->max_signals());
+        }
+        LOG_INFO(log_module, "{}: ring capacity {}, overflow policy {}", can_interface, stage->ring->capacity(), policy_name);
+
+        // The receive thread only decodes and queues, MQTT work happens on the egress threads
+        auto* ingress = stage.get();
+        auto sub = can_receivers_[can_interface]->subscribe_batch([this, ingress](std::span<const CanFrame> frames)
+        {
+            ingest_frames(*ingress, frames);
+        });
+        subscriptions_.push_back(std::move(sub)); // Keep subscription alive
+        stages_.push_back(std::move(stage));
+
+        can_receivers_[can_interface]->open();
+        can_receivers_[can_interface]->start();
+    }
     return true;
 }
 
-bool Bridge::setup_can_readers()
+bool Bridge::start_egress()
 {
-    // Set up CAN readers for each unique CAN interface in the bindings
-    for(const auto& can_interface  : config_["can_interfaces"]) {
-        std::cout << "Setting up CAN interface: " << can_interface << std::endl;
-        can_receivers_[can_interface] = std::make_shared<LinuxSocketCanReceiver>(can_interface);
+    // Optional: "bridge": { "batching": { "window_ms": 10, "max_batch": 64, "adaptive": true } }
+    if (config_["bridge"].contains("batching")) {
+        const auto& item = config_["bridge"]["batching"];
+        batching_enabled_ = item.value("enabled", true);
+        batching_.window = std::chrono::microseconds(static_cast<int64_t>(item.value("window_ms", 10.0) * 1000));
+        batching_.max_batch = item.value("max_batch", batching_.max_batch);
+        batching_.adaptive = item.value("adaptive", batching_.adaptive);
+        if (batching_enabled_) {
+            LOG_INFO(log_module, "MQTT batching: window {} us, max {} readings{}",
+                     batching_.window.count(), batching_.max_batch, batching_.adaptive ? ", adaptive" : "");
+        }
+    }
 
-        auto sub = can_receivers_[can_interface]->subscribe([this](const CanFrame& f)
-        {
-            std::cout << "ID: 0x" << std::hex << f.id << " len: " << f.data.size() << " data:";
-            for(size_t i = 0; i < f.data.size(); ++i)
-            {
-                std::cout << " " << std::hex << static_cast<int>(f.data[i]);
-            }
-            std::cout << std::endl;
-
-            SensorData data;
-            if (f.data.size() >= 5) { // Expecting at least 5 bytes: 1 for sensor_id and 4 for value
-                std::memcpy(&data.sensor_id, f.data.data(), sizeof(data.sensor_id));
-                std::memcpy(&data.value, f.data.data() + sizeof(data.sensor_id), sizeof(data.value));
-                std::cout << "Parsed Sensor Data - ID: " << static_cast<int>(data.sensor_id) << " Value: " << data.value << std::endl;
-            } else {
-                std::cerr << "Received CAN frame with insufficient data length" << std::endl;
-                return;
-            }
-            
-            nlohmann::json j;
-            j["device"] = sensor_id_to_string(static_cast<SensorId>(data.sensor_id));
-            j["value"] = std::format("{:.2f}", data.value);
-            j["unit"] = sensor_id_to_units(static_cast<SensorId>(data.sensor_id));
-
-            std::string payload = j.dump();
-
-            auto sensor_type = sensor_id_to_type(static_cast<SensorId>(data.sensor_id));
-            if (sensor_type.empty()) {
-                std::cerr << "Unknown sensor type for sensor ID: " << static_cast<int>(data.sensor_id) << std::endl;
-                return;
+    const auto pipeline = config_["bridge"].value("pipeline", nlohmann::json::object());
+    size_t workers = pipeline.value("egress_threads", size_t{1});
+    workers = std::clamp<size_t>(workers, 1, std::max<size_t>(stages_.size(), 1));
+
+    egress_running_.store(true);
+    for (size_t i = 0; i < workers; ++i) {
+        egress_threads_.emplace_back(&Bridge::egress_loop, this, i, workers);
+    }
+    LOG_INFO(log_module, "Started {} MQTT egress thread(s)", workers);
+    return true;
+}
+
+bool Bridge::start_metrics()
+{
+    // Optional: "metrics": { "interval_ms": 10000, "file": "...", "socket": "...", "mqtt_topic": "..." }
+    if (!config_["bridge"].contains("metrics")) {
+        return true;
+    }
+
+    auto options = MetricsExporter::parse_options(config_["bridge"]["metrics"]);
+    if (!options.enabled()) {
+        return true;
+    }
+
+    metrics_exporter_ = std::make_unique<MetricsExporter>(MetricsRegistry::instance(), options,
+        [this](const std::string& topic, const std::string& payload) {
+            if (forwarder_) {
+                auto msg = mqtt::make_message(topic, payload);
+                msg->set_qos(0);
+                forwarder_->publish_if_connected(msg);
             }
+        });
+    return metrics_exporter_->start();
+}
+
+void Bridge::ingest_frames(IngressStage& stage, std::span<const CanFrame> frames)
+{
+    // One clock read per batch
+    const uint64_t callback_ns = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count());
+    const uint64_t timestamp_us = callback_ns / 1000;
 
-            std::string topic;
-            for(const auto& t : mqtt_topics_) {
-                if (t.find(sensor_type) != std::string::npos) {
-                    topic = t;
-                    break;
+    for (const auto& f : frames) {
+        LOG_DEBUG(log_module, "ID: 0x{:x}{} len: {} data: {}", f.id, f.is_fd ? " FD" : "", f.size(), f.payload());
+
+        if (f.timestamp_ns != 0) {
+            stage.kernel_to_callback->record(callback_ns > f.timestamp_ns ? (callback_ns - f.timestamp_ns) / 1000 : 0);
+        }
+
+        // Frames described by the interface's DBC take precedence over the built-in layout
+        if (stage.dbc) {
+            if (const auto* message = stage.dbc->find(f)) {
+                const size_t count = stage.dbc->decode(*message, f, stage.dbc_values.data());
+                for (size_t i = 0; i < count; ++i) {
+                    const auto& v = stage.dbc_values[i];
+                    if (v.signal > UINT8_MAX) {
+                        continue;  // no route for it, see RoutingTable
+                    }
+                    stage.ring->push(SensorRecord{timestamp_us, f.id, static_cast<uint8_t>(v.signal), true, static_cast<float>(v.value)});
                 }
+                continue;
             }
+        }
+
+        // Only the configured trace ID, a sensor payload may start with 0xFF as well
+        if (stage.trace_id && f.id == *stage.trace_id && is_trace_record(f.data.data(), f.size())) {
+            ingest_trace(stage, f, timestamp_us);
+            continue;
+        }
 
-            if (topic.empty()) {
-                std::cerr << "No MQTT topic found for sensor type: " << sensor_type << std::endl;
-                return;
+        // Expecting at least 5 bytes: 1 for sensor_id and 4 for value
+        if (f.size() < sensor_data_wire_size) {
+            LOG_WARN(log_module, "Received CAN frame with insufficient data length");
+            stage.decode_failures->add();
+            continue;
+        }
+
+        // Classic frames carry one reading, FD frames may pack several back to back
+        for (size_t offset = 0; offset + sensor_data_wire_size <= f.size(); offset += sensor_data_wire_size) {
+            SensorData data = decode_sensor_data(f.data.data() + offset);
+            if (static_cast<SensorId>(data.sensor_id) == SensorId::Unknown) {
+                break;  // FD padding
             }
+            stage.ring->push(SensorRecord{timestamp_us, f.id, data.sensor_id, false, data.value});
+        }
+    }
+}
+
+void Bridge::ingest_trace(IngressStage& stage, const CanFrame& frame, uint64_t callback_us)
+{
+    // Kernel time when captured, the producer stamps right before the write
+    const uint64_t received_us = frame.timestamp_ns != 0 ? frame.timestamp_ns / 1000 : callback_us;
+    const TraceRecord trace = decode_trace_record(frame.data.data(), received_us);
+    stage.trace_transit->record(received_us > trace.send_us ? received_us - trace.send_us : 0);
+
+    if (stage.trace_seen) {
+        const uint16_t gap = static_cast<uint16_t>(trace.seq - stage.trace_seq - 1);
+        if (gap != 0 && gap < 0x8000) {
+            stage.trace_lost->add(gap);
+        }
+    }
+    stage.trace_seen = true;
+    stage.trace_seq = trace.seq;
+}
+
+void Bridge::stop_egress()
+{
+    egress_running_.store(false);
+    for (auto& t : egress_threads_) {
+        if (t.joinable()) {
+            t.join();
+        }
+    }
+    egress_threads_.clear();
+
+    if (suppressed_.value() > 0) {
+        LOG_INFO(log_module, "{} readings suppressed by deadband", suppressed_.value());
+    }
+
+    for (const auto& stage : stages_) {
+        if (stage->ring->dropped() > 0) {
+            LOG_WARN(log_module, "{}: {} readings dropped on ring overflow", stage->can_interface, stage->ring->dropped());
+        }
+    }
+}
+
+void Bridge::egress_loop(size_t worker, size_t workers)
+{
+    // Rings are split between workers so that every ring keeps a single consumer
+    std::vector<IngressStage*> owned;
+    for (size_t i = worker; i < stages_.size(); i += workers) {
+        owned.push_back(stages_[i].get());
+    }
+
+    std::vector<uint64_t> reported_drops(owned.size(), 0);
+    std::string payload;  // reused for every message of this worker
 
-            auto msg = mqtt::make_message(topic, payload);
-            msg->set_qos(1);
-            msg->set_retained(false);
+    // Optional aggregation, this worker's readings are grouped per topic and retain flag
+    std::unique_ptr<ReadingBatcher> batcher;
+    if (batching_enabled_) {
+        batcher = std::make_unique<ReadingBatcher>(batching_, routing_.batch_count(),
+            [this](const Route& route, const std::string& batch, size_t, uint64_t received_us) {
+                publish_payload(route, batch, received_us);
+            });
+    }
+
+    LastValueCache last_values(routing_.size());
+    auto next_report = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+
+    constexpr size_t max_drain = 256;  // per ring and round, keeps busy rings from starving the others
+
+    while (true) {
+        // Read the flag before draining: once receivers are stopped, one more empty round means all is published
+        const bool running = egress_running_.load();
+
+        size_t drained = 0;
+        for (auto* stage : owned) {
+            SensorRecord record;
+            for (size_t n = 0; n < max_drain && stage->ring->pop(record); ++n, ++drained) {
+                const Route* route = routing_.lookup(stage->index, record.can_id, record.sensor_id, record.dbc);
+                if (!route) {
+                    LOG_WARN(log_module, "No MQTT route for sensor ID {} on {}", record.sensor_id, stage->can_interface);
+                    stage->unknown_sensors->add();
+                    continue;
+                }
+                const auto now = std::chrono::steady_clock::now();
+                if (!last_values.update(*route, record.value, now)) {
+                    suppressed_.add();
+                    continue;  // inside the deadband
+                }
 
-            {
-                std::lock_guard<std::mutex> lock(mqtt_mutex_);
-                if (client_) {
-                    client_->publish(msg)->wait();
-                    std::cout << "Message published: " << payload << std::endl;
+                serialize_reading(*route, record, payload);
+                if (batcher) {
+                    batcher->add(*route, payload, record.timestamp_us, now);
                 } else {
-                    std::cerr << "MQTT client not initialized" << std::endl;
+                    publish_payload(*route, payload, record.timestamp_us);
                 }
             }
-        });
-        subscriptions_.push_back(std::move(sub)); // Keep subscription alive
+        }
 
-        can_receivers_[can_interface]->open();
-        can_receivers_[can_interface]->start();
+        auto now = std::chrono::steady_clock::now();
+        if (batcher) {
+            batcher->flush_due(now);
+        }
+
+        if (now >= next_report) {
+            for (size_t i = 0; i < owned.size(); ++i) {
+                auto dropped = owned[i]->ring->dropped();
+                if (dropped != reported_drops[i]) {
+                    LOG_WARN(log_module, "{}: {} readings dropped on ring overflow", owned[i]->can_interface, dropped - reported_drops[i]);
+                    owned[i]->ring_dropped->add(dropped - reported_drops[i]);
+                    reported_drops[i] = dropped;
+                }
+                owned[i]->ring_depth->set(static_cast<int64_t>(owned[i]->ring->size()));
+            }
+            next_report = now + std::chrono::seconds(1);
+        }
+
+        if (drained == 0) {
+            if (!running) {
+                if (batcher) {
+                    batcher->flush_all();
+                }
+                break;
+            }
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+        }
+    }
+}
+
+void Bridge::serialize_reading(const Route& route, const SensorRecord& record, std::string& payload)
+{
+    switch (route.format) {
+    case PayloadFormat::Json:
+        serialize_json_payload(route, record.value, payload);
+        break;
+    case PayloadFormat::Packed:
+        serialize_packed_payload(record.sensor_id, record.value, record.timestamp_us, routing_.next_sequence(route), payload);
+        break;
+    }
+}
+
+void Bridge::publish_payload(const Route& route, const std::string& payload, uint64_t received_us)
+{
+    auto msg = mqtt::make_message(route.topic, payload);
+    msg->set_qos(1);
+    msg->set_retained(route.retain);
+
+    // Completion is reported through the publisher's delivery callbacks, egress does not wait for the broker.
+    // While the broker is away the forwarder spools the message instead.
+    if (forwarder_) {
+        forwarder_->publish(msg, received_us);
+        LOG_DEBUG(log_module, "Message queued on {} ({} bytes)", route.topic, payload.size());
+    } else {
+        LOG_ERROR(log_module, "MQTT client not initialized");
+    }
+}
+
+std::shared_ptr<ICanReceiver> Bridge::make_receiver(const std::string& can_interface, const std::string& backend)
+{
+    // Filters go in before open() so that no unwanted frame is ever queued
+    const auto options = receive_options(can_interface);
+    const auto filters_opt = receive_filters(config_, can_interface);
+    if (!filters_opt) {
+        return nullptr;
+    }
+    const auto& filters = *filters_opt;
+
+    std::shared_ptr<ICanReceiver> receiver;
+    if (reactor_) {
+        receiver = std::make_shared<EpollCanReceiver>(can_interface, reactor_, options);
+    } else if (backend == "io_uring") {
+#ifdef HAVE_LIBURING
+        // open() probes the kernel, older ones stay on the socket backend
+        auto uring = std::make_shared<IoUringCanReceiver>(can_interface, options);
+        uring->set_filters(filters);
+        if (uring->open()) {
+            return uring;
+        }
+        LOG_WARN(log_module, "{}: io_uring receive unavailable, using sockets", can_interface);
+#else
+        LOG_WARN(log_module, "{}: built without liburing, using sockets", can_interface);
+#endif
+    }
+
+    if (!receiver) {
+        receiver = std::make_shared<LinuxSocketCanReceiver>(can_interface, options);
+    }
+    receiver->set_filters(filters);
+    return receiver;
+}
+
+bool Bridge::load_dbc_decoders(const std::vector<std::string>& interfaces, std::vector<const DbcDecoder*>& decoders)
+{
+    // Optional: "bridge": { "interfaces": { "vcan0": { "dbc": "vehicle.dbc" } } }
+    decoders.assign(interfaces.size(), nullptr);
+    const auto& bridge = config_["bridge"];
+    if (!bridge.contains("interfaces")) {
+        return true;
+    }
+
+    std::map<std::string, const DbcDecoder*> by_path;
+    for (size_t i = 0; i < interfaces.size(); ++i) {
+        if (!bridge["interfaces"].contains(interfaces[i]) || !bridge["interfaces"][interfaces[i]].contains("dbc")) {
+            continue;
+        }
+
+        const auto path = bridge["interfaces"][interfaces[i]]["dbc"].get<std::string>();
+        auto it = by_path.find(path);
+        if (it == by_path.end()) {
+            auto database = load_dbc_file(path);
+            if (!database) {
+                LOG_ERROR(log_module, "{}: failed to load DBC file {}", interfaces[i], path);
+                return false;
+            }
+            LOG_INFO(log_module, "{}: DBC {} with {} messages", interfaces[i], path, database->messages.size());
+            dbc_decoders_.push_back(std::make_unique<DbcDecoder>(std::move(*database)));
+            it = by_path.emplace(path, dbc_decoders_.back().get()).first;
+        }
+        decoders[i] = it->second;
     }
     return true;
 }
 
+CanReceiveOptions Bridge::receive_options(const std::string& can_interface) const
+{
+    // Optional per-interface tuning: "bridge": { "interfaces": { "vcan0": { ... } } }
+    CanReceiveOptions options;
+    const auto& bridge = config_["bridge"];
+    if (!bridge.contains("interfaces") || !bridge["interfaces"].contains(can_interface)) {
+        return options;
+    }
+
+    const auto& item = bridge["interfaces"][can_interface];
+    options.batch_size = item.value("rx_batch_size", options.batch_size);
+    options.max_wait = std::chrono::microseconds(item.value("rx_max_wait_us", options.max_wait.count()));
+    options.kernel_timestamps = item.value("kernel_timestamps", options.kernel_timestamps);
+    LOG_INFO(log_module, "{}: rx batch {} frames, max wait {} us{}", can_interface, options.batch_size, options.max_wait.count(),
+             options.kernel_timestamps ? ", kernel timestamps" : "");
+    return options;
+}
+
+std::optional<std::vector<CanFilter>> Bridge::receive_filters(const nlohmann::json& config, const std::string& can_interface)
+{
+    // Optional: "bridge": { "interfaces": { "vcan0": { "filters": [ { "id": "0x100", "mask": "0x7FF" } ] } } }
+    std::vector<CanFilter> filters;
+    const auto& bridge = config["bridge"];
+    if (!bridge.contains("interfaces") || !bridge["interfaces"].contains(can_interface) || !bridge["interfaces"][can_interface].contains("filters")) {
+        return filters;
+    }
+
+    // One bad entry rejects the whole list, a partial set would pass frames nobody asked for
+    for (const auto& item : bridge["interfaces"][can_interface]["filters"]) {
+        const auto id = item.is_object() && item.contains("id") ? parse_can_id(item["id"]) : std::nullopt;
+        const auto mask = item.is_object() && item.contains("mask") ? parse_can_id(item["mask"]) : std::nullopt;
+        if (!id || !mask) {
+            LOG_ERROR(log_module, "Invalid filter entry for {} in config: {}", can_interface, item.dump());
+            return std::nullopt;
+        }
+        CanFilter filter;
+        filter.id = *id;
+        filter.mask = *mask;
+        try {
+            filter.is_extended = item.value("extended", false);
+            filter.is_inverted = item.value("inverted", false);
+        }
+        catch (const std::exception& e) {
+            LOG_ERROR(log_module, "Invalid filter entry for {} in config: {}", can_interface, e.what());
+            return std::nullopt;
+        }
+        filters.push_back(filter);
+        LOG_INFO(log_module, "{}: filter id 0x{:x} mask 0x{:x}{}{}", can_interface, filter.id, filter.mask,
+                 filter.is_extended ? " extended" : "", filter.is_inverted ? " inverted" : "");
+    }
+    return filters;
+}
+
+void Bridge::reload_config()
+{
+    auto config_opt = load_config(argc_, argv_);
+    if (!config_opt || !config_opt->contains("bridge")) {
+        LOG_ERROR(log_module, "Failed to reload configuration, keeping current settings");
+        return;
+    }
+
+    // All interfaces are validated before any filter changes
+    std::map<std::string, std::vector<CanFilter>> filters;
+    bool filters_valid = true;
+    for (const auto& [name, reader] : can_receivers_) {
+        auto interface_filters = receive_filters(*config_opt, name);
+        if (!interface_filters) {
+            filters_valid = false;
+            break;
+        }
+        filters[name] = std::move(*interface_filters);
+    }
+
+    if (filters_valid) {
+        for (const auto& [name, reader] : can_receivers_) {
+            if (!reader->set_filters(filters[name])) {
+                LOG_ERROR(log_module, "Failed to update CAN filters on {}", name);
+            }
+        }
+    } else {
+        LOG_ERROR(log_module, "Keeping the current CAN filters");
+    }
+
+    if ((*config_opt)["bridge"].contains("logging")) {
+        Logger::instance().configure((*config_opt)["bridge"]["logging"]);
+    }
+    LOG_INFO(log_module, "Configuration reloaded");
+}
+
 void Bridge::wait() {
+    // Reloads are requested from the signal handler and applied here, outside signal context
+    while (!stop_requested_.load()) {
+        if (reload_requested_.exchange(false)) {
+            reload_config();
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+    LOG_INFO(log_module, "Received stop signal (SIGTERM or SIGINT). Shutting down gracefully...");
+    shutdown_ingress();
+}
+
+void Bridge::shutdown_ingress()
+{
+    for (const auto& [name, reader] : can_receivers_) {
+        reader->stop();
+    }
+    // A receive thread blocked on a full ring would never return from wait()
+    for (auto& stage : stages_) {
+        stage->ring->close();
+    }
     for(const auto& [name, reader] : can_receivers_) {
         reader->wait();
         reader->close();
     }
     subscriptions_.clear();
+    if (recorder_) {
+        recorder_->stop();
+    }
+    if (reactor_) {
+        reactor_->stop();
+    }
+
+    // Receivers are gone, publish what is still queued and stop the egress threads
+    stop_egress();
 }
 
 
 void Bridge::signal_handler(int signum) {
     if (signum == SIGTERM || signum == SIGINT) {
-        std::cout << "Received stop signal (SIGTERM or SIGINT). Shutting down gracefully..." << std::endl;
         if (instance_) {
+            instance_->stop_requested_.store(true);
             for(const auto& [name, reader] : instance_->can_receivers_) {
                 reader->stop();
             }
         }
+    } else if (signum == SIGHUP) {
+        if (instance_) {
+            instance_->reload_requested_.store(true);
+        }
     }
 }
 
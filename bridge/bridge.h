@@ -23,8 +23,11 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <mutex>
+#include <optional>
+#include <thread>
 #include <vector>
 #include <map>
 #include <string>
@@ -32,7 +35,18 @@
 #include <nlohmann/json.hpp>
 #include <mqtt/async_client.h>
 
+#include "can/capture/capture_recorder.h"
+#include "can/dbc/dbc_decoder.h"
 #include "can/linux/sockets/can_receiver.h"
+#include "can/linux/sockets/epoll_can_receiver.h"
+#include "concurrency/spsc_ring.h"
+#include "metrics/metrics.h"
+#include "metrics/metrics_exporter.h"
+#include "mqtt_publisher.h"
+#include "reading_batcher.h"
+#include "routing_table.h"
+#include "store_and_forward.h"
+#include "sensors/sensors_data.h"
 
 
 class Bridge
@@ -51,17 +65,74 @@ public:
     }
 
 protected:
+    // Decoded reading handed from a CAN receive thread to an egress thread
+    struct SensorRecord {
+        uint64_t timestamp_us;  // wall clock at reception
+        uint32_t can_id;
+        uint8_t sensor_id;      // signal index for DBC-decoded frames
+        bool dbc;
+        float value;
+    };
+
+    // One ring per interface: its receive thread is the only producer, one egress thread the only consumer
+    struct IngressStage {
+        size_t index;
+        std::string can_interface;
+        std::unique_ptr<SpscRing<SensorRecord>> ring;
+        Counter* decode_failures;
+        Counter* unknown_sensors;
+        Counter* ring_dropped;
+        Gauge* ring_depth;
+        Histogram* kernel_to_callback;
+        Histogram* trace_transit;
+        Counter* trace_lost;
+        std::optional<uint32_t> trace_id;   // CAN ID of the producer's trace frames on this interface
+        bool trace_seen{false};     // trace state, touched by the receive thread only
+        uint16_t trace_seq{0};
+        const DbcDecoder* dbc{nullptr};             // signal database of this interface, if any
+        std::vector<DbcDecoder::Value> dbc_values;  // decode scratch, sized once
+    };
+
     static void signal_handler(int signum);
     bool connect_mqtt();
     bool setup_can_readers();
+    bool load_dbc_decoders(const std::vector<std::string>& interfaces, std::vector<const DbcDecoder*>& decoders);
+    void ingest_frames(IngressStage& stage, std::span<const CanFrame> frames);
+    void ingest_trace(IngressStage& stage, const CanFrame& frame, uint64_t callback_us);
+    bool start_egress();
+    bool start_metrics();
+    void stop_egress();
+    void shutdown_ingress();
+    void egress_loop(size_t worker, size_t workers);
+    void serialize_reading(const Route& route, const SensorRecord& record, std::string& payload);
+    void publish_payload(const Route& route, const std::string& payload, uint64_t received_us);
+    std::shared_ptr<ICanReceiver> make_receiver(const std::string& can_interface, const std::string& backend);
+    CanReceiveOptions receive_options(const std::string& can_interface) const;
+    static std::optional<std::vector<CanFilter>> receive_filters(const nlohmann::json& config, const std::string& can_interface);
+    void reload_config();
 
 private:
+    int argc_{0};
+    char** argv_{nullptr};
     nlohmann::json config_;
     std::unique_ptr<mqtt::async_client> client_;
+    std::unique_ptr<MqttPublisher> publisher_;
+    std::unique_ptr<StoreAndForward> forwarder_;
+    std::shared_ptr<EpollReactor> reactor_;  // only with the epoll CAN backend
     std::map<std::string, std::shared_ptr<ICanReceiver>> can_receivers_;
+    std::unique_ptr<CaptureRecorder> recorder_;  // holds subscriptions, so declared after the receivers
     std::vector<ICanReceiver::SubscriptionPtr> subscriptions_;
-    mutable std::mutex mqtt_mutex_;
-    std::vector<std::string> mqtt_topics_;
+    std::vector<std::unique_ptr<DbcDecoder>> dbc_decoders_;  // one per distinct DBC file
+    RoutingTable routing_;
+    std::vector<std::unique_ptr<IngressStage>> stages_;
+    std::vector<std::thread> egress_threads_;
+    std::atomic<bool> egress_running_{false};
+    Counter& suppressed_;
+    std::unique_ptr<MetricsExporter> metrics_exporter_;
+    bool batching_enabled_{false};
+    ReadingBatcher::Options batching_;
+    std::atomic<bool> stop_requested_{false};
+    std::atomic<bool> reload_requested_{false};
 
     static std::shared_ptr<Bridge> instance_;
 };
\ No newline at end of file
@@ -0,0 +1,80 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+
+// How many spooled messages StoreAndForward may publish. Messages that arrived while connected
+// and were only spooled to stay behind the backlog pass at once, the backlog itself drains at
+// `rate` messages/s on top. Live traffic is never throttled, and the backlog always shrinks.
+class DrainBudget
+{
+public:
+    using clock = std::chrono::steady_clock;
+
+    explicit DrainBudget(double rate)
+        : rate_(std::max(rate, 1.0))
+        , max_backlog_tokens_(std::max(rate_ / 10.0, 1.0))     // at most a tenth of a second in one go
+    {
+    }
+
+    // After a (re)connect, the outage does not count as saved-up budget
+    void reset(clock::time_point now)
+    {
+        backlog_tokens_ = 0.0;
+        live_ = 0;
+        last_refill_ = now;
+    }
+
+    void add_live(uint64_t messages) { live_ += messages; }
+
+    // Messages that may be published now
+    size_t refill(clock::time_point now)
+    {
+        const double elapsed = std::chrono::duration<double>(now - last_refill_).count();
+        last_refill_ = now;
+        backlog_tokens_ = std::min(backlog_tokens_ + elapsed * rate_, max_backlog_tokens_);
+        return static_cast<size_t>(live_) + static_cast<size_t>(backlog_tokens_);
+    }
+
+    void consume(size_t sent)
+    {
+        const uint64_t from_live = std::min<uint64_t>(sent, live_);
+        live_ -= from_live;
+        backlog_tokens_ = std::max(backlog_tokens_ - static_cast<double>(sent - from_live), 0.0);
+    }
+
+    // The spool ran empty, nothing live is waiting in it any more
+    void clear_live() { live_ = 0; }
+
+private:
+    double rate_;
+    double max_backlog_tokens_;
+    double backlog_tokens_{0.0};
+    uint64_t live_{0};
+    clock::time_point last_refill_{};
+};
@@ -0,0 +1,79 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+#include "routing_table.h"
+
+
+// Last published value per route, decides whether a new reading is worth publishing
+// according to the route's Deadband. Not thread safe: one per egress thread.
+class LastValueCache
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit LastValueCache(size_t route_count)
+        : entries_(route_count)
+    {
+    }
+
+    // Returns true and records the value if the reading must be published
+    bool update(const Route& route, float value, Clock::time_point now)
+    {
+        Entry& e = entries_[route.index];
+        const Deadband& db = route.deadband;
+
+        bool publish = !e.valid || !db.enabled();
+        if (!publish && db.heartbeat.count() > 0 && now - e.published >= db.heartbeat) {
+            publish = true;
+        }
+        if (!publish) {
+            const float diff = std::fabs(value - e.value);
+            publish = std::isnan(diff)
+                || (db.exact() && diff > 0.0f)
+                || (db.absolute > 0.0f && diff > db.absolute)
+                || (db.relative > 0.0f && diff > db.relative * std::fabs(e.value));
+        }
+
+        if (publish) {
+            e.value = value;
+            e.published = now;
+            e.valid = true;
+        }
+        return publish;
+    }
+
+private:
+    struct Entry {
+        float value{0.0f};
+        Clock::time_point published;
+        bool valid{false};
+    };
+
+    std::vector<Entry> entries_;
+};
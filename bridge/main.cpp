@@ -21,24 +21,26 @@
  *
  */
 
-#include <iostream>
 #include <memory>
 
 #include "bridge.h"
+#include "logging/logger.h"
 
 
+static LogModule log_module("main");
+
 int main(int argc, char* argv[])
 {
     auto app = std::make_shared<Bridge>();
     Bridge::set_instance(app);
 
     if (!app->initialize(argc, argv)) {
-        std::cerr << "Failed to initialize the bridge" << std::endl;
+        LOG_ERROR(log_module, "Failed to initialize the bridge");
         return 1;
     }
 
     if (!app->start()) {
-        std::cerr << "Failed to start the bridge" << std::endl;
+        LOG_ERROR(log_module, "Failed to start the bridge");
         return 1;
     }
 
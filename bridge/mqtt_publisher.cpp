@@ -0,0 +1,149 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+
+#include "mqtt_publisher.h"
+
+#include "logging/logger.h"
+
+
+static LogModule log_module("mqtt");
+
+namespace {
+    uint64_t now_us()
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+    }
+
+    uint64_t elapsed_us(uint64_t from, uint64_t to)
+    {
+        return to > from ? to - from : 0;
+    }
+}
+
+MqttPublisher::MqttPublisher(mqtt::async_client& client, Options options)
+    : client_(client)
+    , options_(options)
+    , published_(MetricsRegistry::instance().counter("mqtt_published_total", "MQTT messages handed to the client"))
+    , acked_(MetricsRegistry::instance().counter("mqtt_acked_total", "MQTT messages acknowledged by the broker"))
+    , failed_(MetricsRegistry::instance().counter("mqtt_failed_total", "MQTT messages that failed to publish or deliver"))
+    , in_flight_gauge_(MetricsRegistry::instance().gauge("mqtt_in_flight", "MQTT messages waiting for a broker ack"))
+    , callback_to_publish_(MetricsRegistry::instance().histogram("bridge_callback_to_publish_seconds",
+          "Time from the CAN receive callback to the MQTT publish call", {}, 1e-6))
+    , publish_to_ack_(MetricsRegistry::instance().histogram("bridge_publish_to_ack_seconds",
+          "Time from the MQTT publish call to the broker ack", {}, 1e-6))
+    , receive_to_ack_(MetricsRegistry::instance().histogram("bridge_receive_to_ack_seconds",
+          "Time from CAN frame reception to MQTT broker ack", {}, 1e-6))
+{
+    if (options_.max_in_flight == 0) {
+        options_.max_in_flight = 1;
+    }
+
+    // The window bounds the messages in flight, so one slot each is enough
+    slots_.resize(options_.max_in_flight);
+    for (size_t i = options_.max_in_flight; i > 0; --i) {
+        free_slots_.push_back(i - 1);
+    }
+}
+
+bool MqttPublisher::publish(mqtt::message_ptr msg, uint64_t received_us, std::chrono::milliseconds max_wait)
+{
+    size_t slot = 0;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        const auto has_room = [this] { return in_flight_.load() < options_.max_in_flight; };
+        if (max_wait == std::chrono::milliseconds::max()) {
+            cv_.wait(lock, has_room);
+        }
+        else if (!cv_.wait_for(lock, max_wait, has_room)) {
+            return false;
+        }
+        in_flight_.fetch_add(1);
+        slot = free_slots_.back();
+        free_slots_.pop_back();
+    }
+    in_flight_gauge_.add(1);
+    published_.add();
+
+    const uint64_t published_us = now_us();
+    slots_[slot] = {received_us, published_us, msg};
+    if (received_us != 0) {
+        callback_to_publish_.record(elapsed_us(received_us, published_us));
+    }
+
+    try {
+        // The slot index rides along as the token's user context, no per-message allocation
+        client_.publish(msg, reinterpret_cast<void*>(slot), *this);
+    }
+    catch (const mqtt::exception& e) {
+        LOG_DEBUG(log_module, "MQTT publish failed: {}", e.what());
+        failed_.add();
+        release(slot);
+        return false;
+    }
+    return true;
+}
+
+bool MqttPublisher::flush(std::chrono::milliseconds timeout)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    return cv_.wait_for(lock, timeout, [this] { return in_flight_.load() == 0; });
+}
+
+void MqttPublisher::on_success(const mqtt::token& tok)
+{
+    acked_.add();
+
+    const auto slot = reinterpret_cast<size_t>(tok.get_user_context());
+    const Slot& timing = slots_[slot];
+    const uint64_t acked_us = now_us();
+    publish_to_ack_.record(elapsed_us(timing.published_us, acked_us));
+    if (timing.received_us != 0) {
+        receive_to_ack_.record(elapsed_us(timing.received_us, acked_us));
+    }
+    release(slot);
+}
+
+void MqttPublisher::on_failure(const mqtt::token& tok)
+{
+    failed_.add();
+    LOG_WARN(log_module, "MQTT delivery failed, return code {}", tok.get_return_code());
+
+    const auto slot = reinterpret_cast<size_t>(tok.get_user_context());
+    if (on_failed_ && slots_[slot].msg) {
+        on_failed_(slots_[slot].msg, slots_[slot].received_us);
+    }
+    release(slot);
+}
+
+void MqttPublisher::release(size_t slot)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        slots_[slot].msg.reset();
+        in_flight_.fetch_sub(1);
+        free_slots_.push_back(slot);
+    }
+    in_flight_gauge_.add(-1);
+    cv_.notify_all();
+}
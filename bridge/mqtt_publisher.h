@@ -0,0 +1,102 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#include <mqtt/async_client.h>
+
+#include "metrics/metrics.h"
+
+
+// Publishes without waiting for the broker: up to max_in_flight messages are
+// outstanding at once and completion is tracked from the delivery callbacks.
+class MqttPublisher : public mqtt::iaction_listener
+{
+public:
+    struct Options {
+        size_t max_in_flight{64};
+    };
+
+    // Gets messages the broker did not ack, with their `received_us`
+    using FailureHandler = std::function<void(mqtt::message_ptr msg, uint64_t received_us)>;
+
+    MqttPublisher(mqtt::async_client& client, Options options);
+    ~MqttPublisher() override = default;
+
+    // Blocks only while the in-flight window is full, at most `max_wait`. `received_us` is the CAN
+    // reception time (µs since epoch) of the oldest reading in the message, used for the
+    // callback->publish and receive->ack latencies; 0 records only publish->ack. False when the
+    // window stayed full or the client refused the message.
+    bool publish(mqtt::message_ptr msg, uint64_t received_us = 0,
+                 std::chrono::milliseconds max_wait = std::chrono::milliseconds::max());
+
+    // Set before the first publish
+    void set_failure_handler(FailureHandler handler) { on_failed_ = std::move(handler); }
+
+    // Waits until every outstanding message was acked or failed
+    bool flush(std::chrono::milliseconds timeout);
+
+    uint64_t in_flight() const { return in_flight_.load(); }
+    uint64_t acked() const { return acked_.value(); }
+    uint64_t failed() const { return failed_.value(); }
+
+private:
+    void on_success(const mqtt::token& tok) override;
+    void on_failure(const mqtt::token& tok) override;
+    void release(size_t slot);
+
+private:
+    // Per in-flight message timing, indexed by the token's user context
+    struct Slot {
+        uint64_t received_us{0};
+        uint64_t published_us{0};
+        mqtt::message_ptr msg;          // kept for the failure handler
+    };
+
+    mqtt::async_client& client_;
+    Options options_;
+    FailureHandler on_failed_;
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+
+    std::atomic<uint64_t> in_flight_{0};
+    std::vector<Slot> slots_;
+    std::vector<size_t> free_slots_;    // guarded by mutex_
+
+    Counter& published_;
+    Counter& acked_;
+    Counter& failed_;
+    Gauge& in_flight_gauge_;
+    Histogram& callback_to_publish_;
+    Histogram& publish_to_ack_;
+    Histogram& receive_to_ack_;
+};
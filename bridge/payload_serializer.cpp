@@ -0,0 +1,33 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+
+#include "payload_serializer.h"
+
+#include <nlohmann/json.hpp>
+
+
+std::string make_json_payload_prefix(const std::string& device, const std::string& unit)
+{
+    // Let nlohmann do the string escaping so the output matches dump() exactly
+    return "{\"device\":" + nlohmann::json(device).dump() + ",\"unit\":" + nlohmann::json(unit).dump() + ",\"value\":\"";
+}
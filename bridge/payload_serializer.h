@@ -0,0 +1,83 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+
+#pragma once
+
+#include <bit>
+#include <charconv>
+#include <cstdint>
+#include <string>
+
+#include "routing_table.h"
+
+
+// Builds the JSON reading payload {"device":"...","unit":"...","value":"23.45"} without
+// a JSON DOM. Output is byte-identical to nlohmann::json::dump() of the same object
+// with the value formatted by std::format("{:.2f}"): keys in sorted order, strings
+// escaped by nlohmann once when the template is built.
+
+// Everything up to the value: {"device":"...","unit":"...","value":"
+std::string make_json_payload_prefix(const std::string& device, const std::string& unit);
+
+// Overwrites `out` with the payload, `out` keeps its capacity between calls
+inline void serialize_json_payload(const Route& route, float value, std::string& out)
+{
+    static constexpr char suffix[] = "\"}";
+    char number[64];
+
+    auto [end, ec] = std::to_chars(number, number + sizeof(number), value, std::chars_format::fixed, 2);
+    if (ec != std::errc{}) {
+        end = number;
+    }
+
+    out.assign(route.json_prefix);
+    out.append(number, end);
+    out.append(suffix, sizeof(suffix) - 1);
+}
+
+// Packed reading payload, 18 bytes, all fields little-endian:
+//
+//   offset  size  field
+//   0       1     format version, currently 1
+//   1       1     sensor_id
+//   2       4     value, IEEE-754 float
+//   6       8     timestamp, microseconds since the Unix epoch at CAN reception
+//   14      4     sequence, per route (routes sharing a topic count separately), wraps at 2^32
+constexpr uint8_t packed_payload_version = 1;
+constexpr size_t packed_payload_size = 18;
+
+inline void serialize_packed_payload(uint8_t sensor_id, float value, uint64_t timestamp_us, uint32_t sequence, std::string& out)
+{
+    auto put = [&out](uint64_t v, size_t bytes) {
+        for (size_t i = 0; i < bytes; ++i) {
+            out.push_back(static_cast<char>((v >> (8 * i)) & 0xFF));
+        }
+    };
+
+    out.clear();
+    put(packed_payload_version, 1);
+    put(sensor_id, 1);
+    put(std::bit_cast<uint32_t>(value), 4);
+    put(timestamp_us, 8);
+    put(sequence, 4);
+}
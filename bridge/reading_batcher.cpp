@@ -0,0 +1,93 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+
+#include "reading_batcher.h"
+
+
+ReadingBatcher::ReadingBatcher(Options options, size_t batch_count, Sink sink)
+    : options_(options)
+    , batches_(batch_count)
+    , sink_(std::move(sink))
+{
+    if (options_.max_batch == 0) {
+        options_.max_batch = 1;
+    }
+}
+
+void ReadingBatcher::add(const Route& route, std::string_view reading, uint64_t received_us, Clock::time_point now)
+{
+    Batch& batch = batches_[route.batch_index];
+    const bool json = route.format == PayloadFormat::Json;
+
+    if (batch.count == 0) {
+        batch.route = &route;
+        batch.first = now;
+        batch.received_us = received_us;
+        batch.payload.clear();
+        if (json) {
+            batch.payload.push_back('[');
+        }
+    } else if (json) {
+        batch.payload.push_back(',');
+    }
+
+    batch.payload.append(reading);
+    ++batch.count;
+
+    // Adaptive: light traffic goes out at once, under load batches grow up to the window
+    const bool quiet = options_.adaptive && batch.count == 1 && now - batch.last_flush >= options_.window;
+    if (quiet || batch.count >= options_.max_batch) {
+        flush(batch, now);
+    }
+}
+
+void ReadingBatcher::flush_due(Clock::time_point now)
+{
+    for (auto& batch : batches_) {
+        if (batch.count > 0 && now - batch.first >= options_.window) {
+            flush(batch, now);
+        }
+    }
+}
+
+void ReadingBatcher::flush_all()
+{
+    const auto now = Clock::now();
+    for (auto& batch : batches_) {
+        if (batch.count > 0) {
+            flush(batch, now);
+        }
+    }
+}
+
+void ReadingBatcher::flush(Batch& batch, Clock::time_point now)
+{
+    if (batch.route->format == PayloadFormat::Json) {
+        batch.payload.push_back(']');
+    }
+
+    sink_(*batch.route, batch.payload, batch.count, batch.received_us);
+
+    batch.count = 0;
+    batch.last_flush = now;
+}
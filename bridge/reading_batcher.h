@@ -0,0 +1,77 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "routing_table.h"
+
+
+// Collects serialized readings per topic, format and retain flag and hands them out as one payload when the
+// batch window ends or max_batch readings are pending. JSON readings become a JSON
+// array, packed readings are concatenated records. Not thread safe: one per egress thread.
+class ReadingBatcher
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Options {
+        std::chrono::microseconds window{10000};
+        size_t max_batch{64};
+        bool adaptive{false};   // publish at once when the topic was quiet for a whole window
+    };
+
+    // `received_us` is the reception time of the oldest reading in the batch
+    using Sink = std::function<void(const Route& route, const std::string& payload, size_t count, uint64_t received_us)>;
+
+    ReadingBatcher(Options options, size_t batch_count, Sink sink);
+
+    void add(const Route& route, std::string_view reading, uint64_t received_us, Clock::time_point now);
+
+    // Flushes every batch whose window has ended
+    void flush_due(Clock::time_point now);
+    void flush_all();
+
+private:
+    struct Batch {
+        const Route* route{nullptr};
+        std::string payload;
+        size_t count{0};
+        uint64_t received_us{0};
+        Clock::time_point first;
+        Clock::time_point last_flush;
+    };
+
+    void flush(Batch& batch, Clock::time_point now);
+
+private:
+    Options options_;
+    std::vector<Batch> batches_;    // indexed by Route::batch_index
+    Sink sink_;
+};
@@ -0,0 +1,240 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+
+#include "routing_table.h"
+
+#include <algorithm>
+#include <cstdio>
+
+#include "can/can_frame.h"
+#include "logging/logger.h"
+#include "payload_serializer.h"
+#include "sensors/sensors_data.h"
+
+
+static LogModule log_module("routing");
+
+namespace {
+    void replace_all(std::string& s, std::string_view from, const std::string& to) {
+        for (size_t pos = s.find(from); pos != std::string::npos; pos = s.find(from, pos + to.size())) {
+            s.replace(pos, from.size(), to);
+        }
+    }
+
+    std::string to_hex(uint32_t value) {
+        char buf[16];
+        std::snprintf(buf, sizeof(buf), "0x%X", value);
+        return buf;
+    }
+
+    bool is_known_sensor(uint8_t sensor_id) {
+        return !sensor_id_to_type(static_cast<SensorId>(sensor_id)).empty();
+    }
+}
+
+bool RoutingTable::build(const nlohmann::json& bridge_config, const std::vector<std::string>& interfaces,
+                         std::span<const DbcDecoder* const> decoders)
+{
+    routes_.clear();
+    by_id_.clear();
+    batch_keys_.clear();
+    by_sensor_.fill(-1);
+
+    // Fallback routes: first configured topic that mentions the sensor type
+    const auto topics = bridge_config.value("mqtt_topics", std::vector<std::string>{});
+    for (unsigned id = 0; id < by_sensor_.size(); ++id) {
+        const auto sensor = static_cast<SensorId>(id);
+        const auto type = sensor_id_to_type(sensor);
+        if (type.empty()) {
+            continue;
+        }
+
+        for (const auto& t : topics) {
+            if (t.find(type) != std::string::npos) {
+                Route route;
+                route.topic = t;
+                route.device = sensor_id_to_string(sensor);
+                route.unit = sensor_id_to_units(sensor);
+                route.sensor_id = static_cast<uint8_t>(id);
+                by_sensor_[id] = add_route(std::move(route), bridge_config);
+                break;
+            }
+        }
+
+        if (by_sensor_[id] < 0) {
+            LOG_WARN(log_module, "No MQTT topic found for sensor type: {}", type);
+        }
+    }
+
+    // Explicit routes first, DBC signal routes only fill in what they leave open
+    for (const auto& item : bridge_config.value("routes", nlohmann::json::array())) {
+        if (!item.contains("interface") || !item.contains("msg_id") || !item.contains("topic") ||
+            !item["interface"].is_string() || !item["topic"].is_string()) {
+            LOG_WARN(log_module, "Invalid route entry in config: {}", item.dump());
+            return false;
+        }
+
+        const std::string interface = item["interface"];
+        auto it = std::find(interfaces.begin(), interfaces.end(), interface);
+        if (it == interfaces.end()) {
+            LOG_WARN(log_module, "Route references unknown CAN interface: {}", interface);
+            return false;
+        }
+        const size_t interface_index = static_cast<size_t>(it - interfaces.begin());
+        const auto can_id = item["msg_id"].is_string() ? parse_can_id(item["msg_id"].get_ref<const std::string&>())
+                                                       : std::nullopt;
+        if (!can_id) {
+            LOG_WARN(log_module, "Route has an invalid msg_id: {}", item.dump());
+            return false;
+        }
+        const std::string pattern = item["topic"];
+
+        // Without a sensor_id the route covers every known sensor on that CAN ID
+        std::vector<uint8_t> sensor_ids;
+        if (item.contains("sensor_id")) {
+            const auto& sensor_id = item["sensor_id"];
+            if (!sensor_id.is_number_unsigned() || sensor_id.get<uint64_t>() > UINT8_MAX) {
+                LOG_WARN(log_module, "Route sensor_id must be 0..255: {}", item.dump());
+                return false;
+            }
+            sensor_ids.push_back(sensor_id.get<uint8_t>());
+        } else {
+            for (unsigned id = 1; id < by_sensor_.size(); ++id) {
+                if (is_known_sensor(static_cast<uint8_t>(id))) {
+                    sensor_ids.push_back(static_cast<uint8_t>(id));
+                }
+            }
+        }
+
+        for (uint8_t sensor_id : sensor_ids) {
+            const auto sensor = static_cast<SensorId>(sensor_id);
+            Route route;
+            route.topic = expand(pattern, interface, *can_id, sensor_id);
+            route.device = sensor_id_to_string(sensor);
+            route.unit = sensor_id_to_units(sensor);
+            route.sensor_id = sensor_id;
+            LOG_INFO(log_module, "Route {} {} sensor {} -> {}", interface, to_hex(*can_id), sensor_id, route.topic);
+            by_id_[key(interface_index, *can_id, sensor_id)] = add_route(std::move(route), bridge_config);
+        }
+    }
+
+    for (size_t i = 0; i < decoders.size() && i < interfaces.size(); ++i) {
+        if (decoders[i]) {
+            add_signal_routes(bridge_config, i, interfaces[i], *decoders[i]);
+        }
+    }
+
+    sequences_ = std::vector<std::atomic<uint32_t>>(routes_.size());
+    return true;
+}
+
+void RoutingTable::add_signal_routes(const nlohmann::json& bridge_config, size_t interface_index, const std::string& interface,
+                                     const DbcDecoder& decoder)
+{
+    const std::string pattern = bridge_config.value("dbc_topic", std::string("{interface}/{message}/{signal}"));
+    size_t added = 0;
+    for (const auto& message : decoder.database().messages) {
+        // The ring record has 8 bits for the signal index
+        if (message.signals.size() > by_sensor_.size()) {
+            LOG_WARN(log_module, "{}: DBC message {} has {} signals, only the first {} are routed",
+                     interface, message.name, message.signals.size(), by_sensor_.size());
+        }
+
+        const size_t count = std::min(message.signals.size(), by_sensor_.size());
+        for (size_t s = 0; s < count; ++s) {
+            const auto k = key(interface_index, message.id, static_cast<uint8_t>(s));
+            if (by_id_.count(k)) {
+                continue;
+            }
+
+            const auto& signal = message.signals[s];
+            Route route;
+            route.topic = expand_signal(pattern, interface, message, signal);
+            route.device = signal.name;
+            route.unit = signal.unit;
+            route.sensor_id = static_cast<uint8_t>(s);
+            by_id_[k] = add_route(std::move(route), bridge_config);
+            ++added;
+        }
+    }
+    LOG_INFO(log_module, "{}: {} DBC signal routes, topic {}", interface, added, pattern);
+}
+
+std::string RoutingTable::expand_signal(const std::string& pattern, const std::string& interface,
+                                        const DbcMessage& message, const DbcSignal& signal)
+{
+    std::string topic = pattern;
+    replace_all(topic, "{interface}", interface);
+    replace_all(topic, "{msg_id}", to_hex(message.id));
+    replace_all(topic, "{message}", message.name);
+    replace_all(topic, "{signal}", signal.name);
+    replace_all(topic, "{unit}", signal.unit);
+    return topic;
+}
+
+std::string RoutingTable::expand(const std::string& pattern, const std::string& interface, uint32_t can_id, uint8_t sensor_id)
+{
+    const auto sensor = static_cast<SensorId>(sensor_id);
+    std::string topic = pattern;
+    replace_all(topic, "{device}", sensor_id_to_string(sensor));
+    replace_all(topic, "{type}", sensor_id_to_type(sensor));
+    replace_all(topic, "{unit}", sensor_id_to_units(sensor));
+    replace_all(topic, "{interface}", interface);
+    replace_all(topic, "{msg_id}", to_hex(can_id));
+    replace_all(topic, "{sensor_id}", std::to_string(sensor_id));
+    return topic;
+}
+
+int32_t RoutingTable::add_route(Route route, const nlohmann::json& bridge_config)
+{
+    if (bridge_config.contains("payload_formats") && bridge_config["payload_formats"].contains(route.topic)) {
+        const std::string format = bridge_config["payload_formats"][route.topic];
+        if (format == "packed") {
+            route.format = PayloadFormat::Packed;
+        } else if (format != "json") {
+            LOG_WARN(log_module, "Unknown payload format {} for topic {}, using json", format, route.topic);
+        }
+    }
+
+    // "last_value": { "default": { ... }, "temperature_sensor1": { "absolute": 0.1, "heartbeat_ms": 10000, "retain": true } }
+    // A heartbeat_ms without absolute/relative publishes on any change and at least every heartbeat
+    if (bridge_config.contains("last_value")) {
+        const auto& last_value = bridge_config["last_value"];
+        const auto settings = last_value.contains(route.device) ? last_value[route.device] : last_value.value("default", nlohmann::json::object());
+        route.deadband.absolute = settings.value("absolute", 0.0f);
+        route.deadband.relative = settings.value("relative", 0.0f);
+        route.deadband.heartbeat = std::chrono::milliseconds(settings.value("heartbeat_ms", 0));
+        route.retain = settings.value("retain", false);
+    }
+
+    route.json_prefix = make_json_payload_prefix(route.device, route.unit);
+    route.index = static_cast<uint32_t>(routes_.size());
+    // Readings only share an MQTT message when they agree on how it is published
+    std::string batch_key = route.topic;
+    batch_key.push_back('\0');
+    batch_key.push_back(static_cast<char>(route.format));
+    batch_key.push_back(route.retain ? '1' : '0');
+    route.batch_index = batch_keys_.emplace(std::move(batch_key), static_cast<uint32_t>(batch_keys_.size())).first->second;
+    routes_.push_back(std::move(route));
+    return static_cast<int32_t>(routes_.size() - 1);
+}
@@ -0,0 +1,140 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "can/dbc/dbc_decoder.h"
+
+
+enum class PayloadFormat : uint8_t {
+    Json,       // {"device":"...","unit":"...","value":"23.45"}
+    Packed,     // fixed binary layout, see payload_serializer.h
+};
+
+// On-change publishing: a reading is suppressed unless it moved more than `absolute`
+// or `relative` * |last published value|, or `heartbeat` passed since the last publish.
+// A heartbeat alone suppresses readings equal to the last published value.
+// All zero = publish every reading.
+struct Deadband {
+    float absolute{0.0f};
+    float relative{0.0f};
+    std::chrono::milliseconds heartbeat{0};
+
+    bool enabled() const { return absolute > 0.0f || relative > 0.0f || heartbeat.count() > 0; }
+    bool exact() const { return absolute <= 0.0f && relative <= 0.0f; }
+};
+
+// Everything needed to publish a reading, resolved once at startup
+struct Route {
+    std::string topic;
+    std::string device;
+    std::string unit;
+    uint8_t sensor_id{0};
+    PayloadFormat format{PayloadFormat::Json};
+    Deadband deadband;
+    bool retain{false};         // publish as retained so late subscribers get the last value
+    std::string json_prefix;    // JSON payload up to the value, see payload_serializer.h
+    uint32_t index{0};          // position in the table, keys per-route state
+    uint32_t batch_index{0};    // same value for all routes with the same topic, format and retain flag
+};
+
+// Maps (interface, CAN ID, sensor id) to a Route. Built from config before the
+// receivers start, lookups are an integer hash probe and an array index and never allocate.
+//
+// Explicit routes come from "bridge": { "routes": [ ... ] }, each entry names an interface,
+// a msg_id, an optional sensor_id and a topic template that may use {device}, {type},
+// {unit}, {interface}, {msg_id} and {sensor_id}. Readings without an explicit route fall
+// back to the first entry of "mqtt_topics" that contains the sensor type.
+// "payload_formats" maps a topic to "json" (default) or "packed".
+// "last_value" holds deadband/retain settings per device name, with "default" for the rest.
+//
+// Interfaces with a DBC database get a route per signal, keyed by the signal's index in its
+// message in place of the sensor id. Topics follow "dbc_topic" with {interface}, {msg_id},
+// {message}, {signal} and {unit}; the signal name is the device. Their readings never use the
+// sensor id fallback, a signal index is not a SensorId.
+class RoutingTable
+{
+public:
+    RoutingTable() { by_sensor_.fill(-1); }
+
+    // `decoders` holds the DBC decoder of each interface (same order, nullptr for none)
+    bool build(const nlohmann::json& bridge_config, const std::vector<std::string>& interfaces,
+               std::span<const DbcDecoder* const> decoders = {});
+
+    // `dbc`: `sensor_id` is the signal index of a DBC-decoded message
+    const Route* lookup(size_t interface_index, uint32_t can_id, uint8_t sensor_id, bool dbc = false) const
+    {
+        if (!by_id_.empty()) {
+            auto it = by_id_.find(key(interface_index, can_id, sensor_id));
+            if (it != by_id_.end())
+                return &routes_[it->second];
+        }
+        if (dbc)
+            return nullptr;
+        int32_t index = by_sensor_[sensor_id];
+        return index < 0 ? nullptr : &routes_[index];
+    }
+
+    size_t size() const { return routes_.size(); }
+    // Number of distinct batch_index values
+    size_t batch_count() const { return batch_keys_.size(); }
+
+    // Per-route message counter for the packed format, safe to call from any egress thread
+    uint32_t next_sequence(const Route& route) const
+    {
+        return sequences_[route.index].fetch_add(1, std::memory_order_relaxed);
+    }
+
+private:
+    static uint64_t key(size_t interface_index, uint32_t can_id, uint8_t sensor_id)
+    {
+        return (static_cast<uint64_t>(interface_index) << 40) | (static_cast<uint64_t>(can_id) << 8) | sensor_id;
+    }
+
+    static std::string expand(const std::string& pattern, const std::string& interface, uint32_t can_id, uint8_t sensor_id);
+    static std::string expand_signal(const std::string& pattern, const std::string& interface,
+                                     const DbcMessage& message, const DbcSignal& signal);
+
+    void add_signal_routes(const nlohmann::json& bridge_config, size_t interface_index, const std::string& interface,
+                           const DbcDecoder& decoder);
+
+    int32_t add_route(Route route, const nlohmann::json& bridge_config);
+
+private:
+    std::vector<Route> routes_;
+    std::unordered_map<uint64_t, int32_t> by_id_;   // explicit routes
+    std::unordered_map<std::string, uint32_t> batch_keys_;   // topic + format + retain -> batch_index
+    std::array<int32_t, 256> by_sensor_{};          // fallback by sensor id, -1 = no route
+    mutable std::vector<std::atomic<uint32_t>> sequences_;
+};
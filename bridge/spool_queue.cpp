@@ -0,0 +1,450 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+#include "spool_queue.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "logging/logger.h"
+
+
+static LogModule log_module("spool");
+
+namespace {
+    constexpr uint32_t record_magic = 0x4C505351;     // "QSPL"
+    constexpr const char* cursor_name = "cursor";
+
+    // Followed by the topic and the payload, records start 8-byte aligned
+    struct RecordHeader {
+        uint32_t magic;
+        uint32_t body_len;
+        uint64_t received_us;
+        uint16_t topic_len;
+        uint8_t qos;
+        uint8_t retain;
+        uint32_t checksum;
+    };
+    static_assert(sizeof(RecordHeader) == 24);
+
+    struct Cursor {
+        uint64_t sequence{0};
+        uint64_t offset{0};
+    };
+
+    uint64_t padded(uint64_t size)
+    {
+        return (size + 7) & ~uint64_t{7};
+    }
+
+    uint32_t fnv1a(const uint8_t* data, size_t size)
+    {
+        uint32_t hash = 2166136261u;
+        for (size_t i = 0; i < size; ++i) {
+            hash = (hash ^ data[i]) * 16777619u;
+        }
+        return hash;
+    }
+
+    // Size of the valid record at `offset`, 0 at the end of the written part
+    uint64_t valid_record(const uint8_t* data, uint64_t used, uint64_t offset)
+    {
+        if (offset + sizeof(RecordHeader) > used) {
+            return 0;
+        }
+        RecordHeader header;
+        std::memcpy(&header, data + offset, sizeof(header));
+        const uint64_t size = padded(sizeof(RecordHeader) + header.body_len);
+        if (header.magic != record_magic || header.topic_len > header.body_len || offset + size > used) {
+            return 0;
+        }
+        if (fnv1a(data + offset + sizeof(RecordHeader), header.body_len) != header.checksum) {
+            return 0;
+        }
+        return size;
+    }
+
+    bool parse_sequence(const std::string& name, uint64_t& sequence)
+    {
+        unsigned long long value = 0;
+        int consumed = 0;
+        if (std::sscanf(name.c_str(), "spool-%llu.dat%n", &value, &consumed) != 1 ||
+            static_cast<size_t>(consumed) != name.size()) {
+            return false;
+        }
+        sequence = value;
+        return true;
+    }
+}
+
+SpoolQueue::SpoolQueue(Options options)
+    : options_(std::move(options))
+    , spooled_(MetricsRegistry::instance().counter("spool_messages_total", "MQTT messages written to the disk spool"))
+    , dropped_(MetricsRegistry::instance().counter("spool_dropped_total", "MQTT messages lost because the disk spool was full"))
+    , messages_gauge_(MetricsRegistry::instance().gauge("spool_messages", "MQTT messages waiting in the disk spool"))
+    , bytes_gauge_(MetricsRegistry::instance().gauge("spool_bytes", "Disk space used by the spool segments"))
+{
+    options_.segment_bytes = std::max<uint64_t>(padded(options_.segment_bytes), 64u << 10);
+    // Room for the segment being drained and the one being written
+    options_.max_bytes = std::max(options_.max_bytes, 2 * options_.segment_bytes);
+}
+
+SpoolQueue::~SpoolQueue()
+{
+    close();
+}
+
+bool SpoolQueue::open()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (open_) {
+        return true;
+    }
+
+    std::error_code ec;
+    std::filesystem::create_directories(options_.directory, ec);
+    if (ec) {
+        LOG_ERROR(log_module, "Failed to create spool directory {}: {}", options_.directory, ec.message());
+        return false;
+    }
+
+    std::vector<uint64_t> sequences;
+    for (const auto& entry : std::filesystem::directory_iterator(options_.directory, ec)) {
+        uint64_t sequence = 0;
+        if (entry.is_regular_file() && parse_sequence(entry.path().filename().string(), sequence)) {
+            sequences.push_back(sequence);
+        }
+    }
+    std::sort(sequences.begin(), sequences.end());
+
+    Cursor cursor;
+    std::ifstream cursor_file(std::filesystem::path(options_.directory) / cursor_name, std::ios::binary);
+    if (cursor_file) {
+        cursor_file.read(reinterpret_cast<char*>(&cursor), sizeof(cursor));
+        if (!cursor_file) {
+            cursor = {};
+        }
+    }
+
+    for (uint64_t sequence : sequences) {
+        next_sequence_ = sequence + 1;
+        // Consumed before the last run stopped, the delete may not have happened
+        if (sequence < cursor.sequence) {
+            std::filesystem::remove(path(sequence), ec);
+            continue;
+        }
+        Segment segment;
+        segment.sequence = sequence;
+        if (!map_segment(segment, false)) {
+            continue;
+        }
+        scan(segment);
+        segments_.push_back(segment);
+        bytes_ += segment.capacity;
+        messages_ += segment.messages;
+    }
+
+    if (!segments_.empty() && segments_.front().sequence == cursor.sequence) {
+        // Skip what was already forwarded, stopping early if the cursor is past a torn tail
+        Segment& front = segments_.front();
+        while (read_offset_ < cursor.offset) {
+            const uint64_t size = valid_record(front.data, front.used, read_offset_);
+            if (size == 0) {
+                break;
+            }
+            read_offset_ += size;
+            --front.messages;
+            --messages_;
+        }
+    }
+
+    first_write_sequence_ = next_sequence_;
+    open_ = true;
+    update_gauges();
+    if (messages_ > 0) {
+        LOG_INFO(log_module, "Spool {} holds {} message(s) from an earlier run", options_.directory, messages_);
+    }
+    return true;
+}
+
+void SpoolQueue::close()
+{
+    if (!sync()) {
+        LOG_WARN(log_module, "Failed to save the spool read position");
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& segment : segments_) {
+        ::munmap(segment.data, segment.capacity);
+    }
+    segments_.clear();
+    messages_ = 0;
+    bytes_ = 0;
+    read_offset_ = 0;
+    open_ = false;
+}
+
+bool SpoolQueue::push(std::string_view topic, std::string_view payload, uint64_t received_us, uint8_t qos, bool retain)
+{
+    const uint64_t body_len = topic.size() + payload.size();
+    const uint64_t size = padded(sizeof(RecordHeader) + body_len);
+    if (topic.size() > UINT16_MAX || body_len > UINT32_MAX) {
+        dropped_.add();
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!open_) {
+        dropped_.add();
+        return false;
+    }
+
+    // Segments left by an earlier run are only read, new messages always go to a new segment
+    const bool have_tail = !segments_.empty() && segments_.back().sequence >= first_write_sequence_;
+    if (!have_tail || segments_.back().used + size > segments_.back().capacity) {
+        if (!make_room(std::max(size, options_.segment_bytes))) {
+            dropped_.add();
+            return false;
+        }
+        Segment segment;
+        segment.sequence = next_sequence_++;
+        segment.capacity = std::max(size, options_.segment_bytes);
+        if (!map_segment(segment, true)) {
+            dropped_.add();
+            return false;
+        }
+        if (segments_.empty()) {
+            read_offset_ = 0;
+        }
+        segments_.push_back(segment);
+        bytes_ += segment.capacity;
+    }
+
+    Segment& tail = segments_.back();
+    uint8_t* record = tail.data + tail.used;
+    RecordHeader header{};
+    header.body_len = static_cast<uint32_t>(body_len);
+    header.received_us = received_us;
+    header.topic_len = static_cast<uint16_t>(topic.size());
+    header.qos = qos;
+    header.retain = retain ? 1 : 0;
+
+    std::memcpy(record + sizeof(RecordHeader), topic.data(), topic.size());
+    std::memcpy(record + sizeof(RecordHeader) + topic.size(), payload.data(), payload.size());
+    header.checksum = fnv1a(record + sizeof(RecordHeader), body_len);
+    std::memcpy(record + sizeof(uint32_t), reinterpret_cast<const uint8_t*>(&header) + sizeof(uint32_t),
+                sizeof(RecordHeader) - sizeof(uint32_t));
+    // The magic goes in last, a record cut short by a crash reads as the end of the segment
+    header.magic = record_magic;
+    std::memcpy(record, &header.magic, sizeof(header.magic));
+
+    tail.used += size;
+    ++tail.messages;
+    ++messages_;
+    spooled_.add();
+    update_gauges();
+    return true;
+}
+
+bool SpoolQueue::front(Message& out)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    while (!segments_.empty()) {
+        Segment& segment = segments_.front();
+        const uint64_t size = segment.messages > 0 ? valid_record(segment.data, segment.used, read_offset_) : 0;
+        if (size == 0) {
+            if (segments_.size() == 1) {
+                return false;
+            }
+            remove_front();
+            continue;
+        }
+
+        RecordHeader header;
+        std::memcpy(&header, segment.data + read_offset_, sizeof(header));
+        const char* body = reinterpret_cast<const char*>(segment.data + read_offset_ + sizeof(RecordHeader));
+        out.topic.assign(body, header.topic_len);
+        out.payload.assign(body + header.topic_len, header.body_len - header.topic_len);
+        out.received_us = header.received_us;
+        out.qos = header.qos;
+        out.retain = header.retain != 0;
+        peek_sequence_ = segment.sequence;
+        peek_offset_ = read_offset_;
+        return true;
+    }
+    return false;
+}
+
+void SpoolQueue::pop()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    // The message may have been dropped meanwhile to make room, then there is nothing to pop
+    if (segments_.empty() || segments_.front().messages == 0 ||
+        segments_.front().sequence != peek_sequence_ || read_offset_ != peek_offset_) {
+        return;
+    }
+    Segment& segment = segments_.front();
+    read_offset_ += valid_record(segment.data, segment.used, read_offset_);
+    --segment.messages;
+    --messages_;
+    if (segment.messages == 0 && segments_.size() > 1) {
+        remove_front();
+    }
+    update_gauges();
+}
+
+bool SpoolQueue::sync()
+{
+    Cursor cursor;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!open_) {
+            return true;
+        }
+        if (!segments_.empty()) {
+            cursor = {segments_.front().sequence, read_offset_};
+            // Starts the write-back of the records pushed since the last sync
+            const Segment& tail = segments_.back();
+            ::msync(tail.data, tail.capacity, MS_ASYNC);
+        }
+        else {
+            cursor = {next_sequence_, 0};
+        }
+    }
+
+    // Written next to the old cursor and renamed over it, a crash leaves one or the other
+    const auto target = std::filesystem::path(options_.directory) / cursor_name;
+    const auto temp = std::filesystem::path(options_.directory) / (std::string(cursor_name) + ".tmp");
+    const int fd = ::open(temp.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        return false;
+    }
+    const bool written = ::write(fd, &cursor, sizeof(cursor)) == static_cast<ssize_t>(sizeof(cursor));
+    ::close(fd);
+    return written && ::rename(temp.c_str(), target.c_str()) == 0;
+}
+
+uint64_t SpoolQueue::size() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return messages_;
+}
+
+std::string SpoolQueue::path(uint64_t sequence) const
+{
+    char name[32];
+    std::snprintf(name, sizeof(name), "spool-%06llu.dat", static_cast<unsigned long long>(sequence));
+    return (std::filesystem::path(options_.directory) / name).string();
+}
+
+bool SpoolQueue::map_segment(Segment& segment, bool create)
+{
+    const std::string file = path(segment.sequence);
+    const int fd = ::open(file.c_str(), create ? (O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC) : (O_RDWR | O_CLOEXEC), 0644);
+    if (fd < 0) {
+        LOG_ERROR(log_module, "Failed to open {}: {}", file, std::strerror(errno));
+        return false;
+    }
+
+    if (create) {
+        // Allocated up front, running out of disk later would fault on the mapped write
+        const int err = ::posix_fallocate(fd, 0, static_cast<off_t>(segment.capacity));
+        if (err != 0) {
+            LOG_ERROR(log_module, "Failed to allocate {}: {}", file, std::strerror(err));
+            ::close(fd);
+            ::unlink(file.c_str());
+            return false;
+        }
+    }
+    else {
+        const off_t size = ::lseek(fd, 0, SEEK_END);
+        if (size <= 0) {
+            ::close(fd);
+            ::unlink(file.c_str());
+            return false;
+        }
+        segment.capacity = static_cast<uint64_t>(size);
+    }
+
+    void* data = ::mmap(nullptr, segment.capacity, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (data == MAP_FAILED) {
+        LOG_ERROR(log_module, "Failed to map {}: {}", file, std::strerror(errno));
+        if (create) {
+            ::unlink(file.c_str());
+        }
+        return false;
+    }
+    segment.data = static_cast<uint8_t*>(data);
+    return true;
+}
+
+void SpoolQueue::scan(Segment& segment)
+{
+    segment.used = 0;
+    segment.messages = 0;
+    while (const uint64_t size = valid_record(segment.data, segment.capacity, segment.used)) {
+        segment.used += size;
+        ++segment.messages;
+    }
+}
+
+void SpoolQueue::remove_front()
+{
+    Segment& segment = segments_.front();
+    ::munmap(segment.data, segment.capacity);
+    ::unlink(path(segment.sequence).c_str());
+    bytes_ -= segment.capacity;
+    messages_ -= segment.messages;
+    segments_.pop_front();
+    read_offset_ = 0;
+}
+
+bool SpoolQueue::make_room(uint64_t bytes)
+{
+    while (bytes_ + bytes > options_.max_bytes && !segments_.empty()) {
+        if (!options_.drop_oldest) {
+            return false;
+        }
+        const uint64_t lost = segments_.front().messages;
+        if (lost > 0) {
+            LOG_WARN(log_module, "Spool full, dropping {} oldest message(s)", lost);
+            dropped_.add(lost);
+        }
+        remove_front();
+    }
+    return true;
+}
+
+void SpoolQueue::update_gauges()
+{
+    messages_gauge_.set(static_cast<int64_t>(messages_));
+    bytes_gauge_.set(static_cast<int64_t>(bytes_));
+}
@@ -0,0 +1,113 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+#include "metrics/metrics.h"
+
+
+// Bounded FIFO of MQTT messages on disk, used while the broker is unreachable. Messages are
+// appended to memory-mapped segment files (spool-000001.dat, ...) of segment_bytes each; the
+// drain side reads from the same mappings and deletes a segment once it is consumed. A record
+// becomes visible by writing its magic last, so a crash mid-append leaves a zero tail that
+// reading stops at. The read position is persisted by sync(), after a crash messages read
+// since the last sync() are delivered again (QoS 1 allows duplicates anyway).
+class SpoolQueue
+{
+public:
+    struct Options {
+        std::string directory;
+        uint64_t segment_bytes{16u << 20};
+        uint64_t max_bytes{1024u << 20};
+        bool drop_oldest{true};             // when full: delete the oldest segment, else reject new messages
+    };
+
+    struct Message {
+        std::string topic;
+        std::string payload;
+        uint64_t received_us{0};
+        uint8_t qos{1};
+        bool retain{false};
+    };
+
+    explicit SpoolQueue(Options options);
+    ~SpoolQueue();
+
+    SpoolQueue(const SpoolQueue&) = delete;
+    SpoolQueue& operator=(const SpoolQueue&) = delete;
+
+    // Picks up segments left by an earlier run
+    bool open();
+    void close();
+
+    bool push(std::string_view topic, std::string_view payload, uint64_t received_us, uint8_t qos, bool retain);
+
+    // Copies the oldest message into `out`, false when empty. pop() removes it.
+    bool front(Message& out);
+    void pop();
+
+    // Persists the read position
+    bool sync();
+
+    uint64_t size() const;
+    bool empty() const { return size() == 0; }
+
+private:
+    struct Segment {
+        uint64_t sequence{0};
+        uint8_t* data{nullptr};
+        uint64_t capacity{0};
+        uint64_t used{0};
+        uint64_t messages{0};           // not yet popped
+    };
+
+    std::string path(uint64_t sequence) const;
+    bool map_segment(Segment& segment, bool create);
+    void scan(Segment& segment);
+    void remove_front();
+    bool make_room(uint64_t bytes);
+    void update_gauges();
+
+private:
+    Options options_;
+    mutable std::mutex mutex_;
+    std::deque<Segment> segments_;      // oldest first, the last one takes new messages
+    uint64_t next_sequence_{1};
+    uint64_t first_write_sequence_{1};  // segments before this one come from an earlier run
+    uint64_t read_offset_{0};           // into segments_.front()
+    uint64_t peek_sequence_{0};         // position of the message returned by front()
+    uint64_t peek_offset_{0};
+    uint64_t messages_{0};
+    uint64_t bytes_{0};
+    bool open_{false};
+
+    Counter& spooled_;
+    Counter& dropped_;
+    Gauge& messages_gauge_;
+    Gauge& bytes_gauge_;
+};
@@ -0,0 +1,272 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+#include "store_and_forward.h"
+
+#include <algorithm>
+#include <random>
+
+#include "logging/logger.h"
+
+
+static LogModule log_module("mqtt");
+
+StoreAndForward::Options StoreAndForward::parse_options(const nlohmann::json& config)
+{
+    Options options;
+    if (config.value("enabled", true)) {
+        options.spool.directory = config.value("directory", std::string());
+    }
+    options.spool.segment_bytes = config.value("segment_mb", uint64_t{16}) << 20;
+    options.spool.max_bytes = config.value("max_mb", uint64_t{1024}) << 20;
+    options.spool.drop_oldest = config.value("overflow_policy", std::string("drop_oldest")) != "reject";
+    options.drain_rate = std::max(config.value("drain_rate", options.drain_rate), 1.0);
+    options.reconnect_min = std::chrono::milliseconds(config.value("reconnect_min_ms", int64_t{500}));
+    options.reconnect_max = std::chrono::milliseconds(config.value("reconnect_max_ms", int64_t{30000}));
+    options.reconnect_max = std::max(options.reconnect_max, options.reconnect_min);
+    options.publish_wait = std::chrono::milliseconds(config.value("publish_wait_ms", int64_t{50}));
+    return options;
+}
+
+StoreAndForward::StoreAndForward(mqtt::async_client& client, mqtt::connect_options connect_options,
+                                 MqttPublisher& publisher, Options options)
+    : client_(client)
+    , connect_options_(std::move(connect_options))
+    , publisher_(publisher)
+    , options_(std::move(options))
+    , connected_gauge_(MetricsRegistry::instance().gauge("mqtt_connected", "1 while the bridge is connected to the broker"))
+    , connects_(MetricsRegistry::instance().counter("mqtt_connects_total", "Successful connections to the broker"))
+    , dropped_(MetricsRegistry::instance().counter("mqtt_dropped_total", "MQTT messages dropped without a spool, while disconnected or stalled"))
+{
+    if (!options_.spool.directory.empty()) {
+        spool_ = std::make_unique<SpoolQueue>(options_.spool);
+    }
+}
+
+StoreAndForward::~StoreAndForward()
+{
+    stop();
+}
+
+bool StoreAndForward::start()
+{
+    if (spool_) {
+        if (!spool_->open()) {
+            return false;
+        }
+        LOG_INFO(log_module, "Spooling to {} while the broker is unreachable, draining at {} messages/s",
+                 options_.spool.directory, options_.drain_rate);
+    }
+
+    // Deliveries cut off by a lost connection are kept for the drain, QoS 0 ones (metrics) are not worth it
+    publisher_.set_failure_handler([this](mqtt::message_ptr msg, uint64_t received_us) {
+        if (spool_ && msg->get_qos() > 0) {
+            spool(msg, received_us);
+        }
+    });
+    client_.set_connection_lost_handler([this](const std::string& cause) {
+        LOG_WARN(log_module, "Connection to the broker lost: {}", cause.empty() ? "no reason given" : cause);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            connected_.store(false);
+        }
+        connected_gauge_.set(0);
+        cv_.notify_all();
+    });
+
+    connect();
+    running_.store(true);
+    thread_ = std::thread(&StoreAndForward::link_loop, this);
+    return true;
+}
+
+void StoreAndForward::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        running_.store(false);
+    }
+    cv_.notify_all();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+void StoreAndForward::close()
+{
+    if (spool_) {
+        if (!spool_->empty()) {
+            LOG_INFO(log_module, "{} message(s) stay spooled for the next run", spool_->size());
+        }
+        spool_->close();
+    }
+}
+
+void StoreAndForward::publish(mqtt::message_ptr msg, uint64_t received_us)
+{
+    if (!spool_) {
+        if (!connected_.load()) {
+            dropped_.add();
+            return;
+        }
+        if (!publisher_.publish(msg, received_us, options_.publish_wait)) {
+            dropped_.add();
+        }
+        return;
+    }
+
+    // Anything already spooled goes first, so new messages queue behind it. Those spooled while
+    // connected are live traffic, the drain lets them through on top of drain_rate.
+    const bool connected = connected_.load();
+    if (connected && spool_->empty() && publisher_.publish(msg, received_us, options_.publish_wait)) {
+        return;
+    }
+    spool(msg, received_us);
+    if (connected) {
+        live_spooled_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void StoreAndForward::publish_if_connected(mqtt::message_ptr msg)
+{
+    if (connected_.load()) {
+        publisher_.publish(msg, 0, options_.publish_wait);
+    }
+}
+
+bool StoreAndForward::connect()
+{
+    try {
+        client_.connect(connect_options_)->wait();
+    }
+    catch (const mqtt::exception& e) {
+        // One warning per outage, not one per attempt
+        if (failed_attempts_++ == 0) {
+            LOG_WARN(log_module, "Cannot reach the broker: {}, retrying in the background", e.what());
+        }
+        else {
+            LOG_DEBUG(log_module, "Connection attempt {} failed: {}", failed_attempts_, e.what());
+        }
+        return false;
+    }
+
+    if (failed_attempts_ > 0) {
+        LOG_INFO(log_module, "Connected to broker after {} failed attempt(s)", failed_attempts_);
+    }
+    else {
+        LOG_INFO(log_module, "Connected to broker");
+    }
+    failed_attempts_ = 0;
+    connects_.add();
+    connected_gauge_.set(1);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        connected_.store(true);
+    }
+    return true;
+}
+
+void StoreAndForward::spool(const mqtt::message_ptr& msg, uint64_t received_us)
+{
+    spool_->push(msg->get_topic(), msg->get_payload_str(), received_us,
+                 static_cast<uint8_t>(msg->get_qos()), msg->is_retained());
+}
+
+void StoreAndForward::link_loop()
+{
+    using clock = std::chrono::steady_clock;
+
+    std::minstd_rand rng(std::random_device{}());
+    std::uniform_real_distribution<double> jitter(0.5, 1.0);
+
+    auto backoff = options_.reconnect_min;
+    auto next_attempt = clock::now() + backoff;
+    auto last_sync = clock::now();
+    DrainBudget budget(options_.drain_rate);
+    budget.reset(clock::now());
+
+    while (running_.load()) {
+        const auto now = clock::now();
+        const bool connected = connected_.load();
+        auto wake = now + std::chrono::milliseconds(100);
+
+        if (!connected) {
+            if (now >= next_attempt) {
+                if (connect()) {
+                    backoff = options_.reconnect_min;
+                    budget.reset(clock::now());
+                    live_spooled_.store(0, std::memory_order_relaxed);
+                    continue;
+                }
+                backoff = std::min(backoff * 2, options_.reconnect_max);
+                next_attempt = now + std::chrono::duration_cast<std::chrono::milliseconds>(backoff * jitter(rng));
+            }
+            wake = next_attempt;
+        }
+        else if (spool_) {
+            // Backlog at drain_rate so a long outage does not come back as one burst, live traffic unthrottled
+            budget.add_live(live_spooled_.exchange(0, std::memory_order_relaxed));
+            const size_t allowed = budget.refill(now);
+            if (allowed > 0) {
+                budget.consume(drain(allowed));
+            }
+            if (spool_->empty()) {
+                budget.clear_live();
+            }
+            else {
+                wake = now + std::chrono::milliseconds(10);
+            }
+        }
+
+        if (spool_ && now - last_sync >= std::chrono::seconds(1)) {
+            spool_->sync();
+            last_sync = now;
+        }
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait_until(lock, std::min(wake, now + std::chrono::seconds(1)), [this, connected] {
+            return !running_.load() || connected_.load() != connected;
+        });
+    }
+
+    if (spool_) {
+        spool_->sync();
+    }
+}
+
+size_t StoreAndForward::drain(size_t budget)
+{
+    SpoolQueue::Message message;
+    size_t sent = 0;
+    while (sent < budget && connected_.load() && spool_->front(message)) {
+        auto msg = mqtt::make_message(message.topic, message.payload.data(), message.payload.size(),
+                                      message.qos, message.retain);
+        // Only removed once the client has it, a failed delivery comes back through the failure handler.
+        // The original receive time is not passed on, the outage would swamp the latency histograms.
+        if (!publisher_.publish(msg, 0, options_.publish_wait)) {
+            break;
+        }
+        spool_->pop();
+        ++sent;
+    }
+    return sent;
+}
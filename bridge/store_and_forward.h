@@ -0,0 +1,107 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include <mqtt/async_client.h>
+#include <nlohmann/json.hpp>
+
+#include "drain_budget.h"
+#include "metrics/metrics.h"
+#include "mqtt_publisher.h"
+#include "spool_queue.h"
+
+
+// Keeps the MQTT connection up and holds messages while it is down. Connection attempts back
+// off exponentially with jitter. While the broker is away, messages go to a SpoolQueue on disk;
+// after a reconnect new messages queue behind the spool so the broker still sees them in order;
+// they are drained as fast as they arrive, the backlog at drain_rate messages/s on top of that.
+// See DrainBudget. The exception is QoS 1 messages whose delivery
+// failed in flight: they are spooled when the failure is reported, behind anything spooled
+// before, so they can arrive after newer messages. Without a spool directory, messages sent while
+// disconnected or while the in-flight window stays full are dropped.
+class StoreAndForward
+{
+public:
+    struct Options {
+        SpoolQueue::Options spool;          // spool.directory empty: no disk spool
+        double drain_rate{500.0};           // messages/s
+        std::chrono::milliseconds reconnect_min{500};
+        std::chrono::milliseconds reconnect_max{30000};
+        std::chrono::milliseconds publish_wait{50};     // longest a publish waits for the in-flight window
+    };
+
+    // From "bridge.store_and_forward"
+    static Options parse_options(const nlohmann::json& config);
+
+    StoreAndForward(mqtt::async_client& client, mqtt::connect_options connect_options,
+                    MqttPublisher& publisher, Options options);
+    ~StoreAndForward();
+
+    // Tries to connect once, then keeps trying in the background. Fails only if the spool
+    // cannot be opened.
+    bool start();
+    void stop();
+
+    // Saves the spool, after the publisher has been flushed
+    void close();
+
+    // Never waits for the broker longer than publish_wait
+    void publish(mqtt::message_ptr msg, uint64_t received_us);
+
+    // For messages not worth keeping, such as metrics snapshots
+    void publish_if_connected(mqtt::message_ptr msg);
+
+    bool connected() const { return connected_.load(); }
+
+private:
+    bool connect();
+    void spool(const mqtt::message_ptr& msg, uint64_t received_us);
+    void link_loop();
+    size_t drain(size_t budget);
+
+private:
+    mqtt::async_client& client_;
+    mqtt::connect_options connect_options_;
+    MqttPublisher& publisher_;
+    Options options_;
+    std::unique_ptr<SpoolQueue> spool_;
+
+    std::atomic<bool> connected_{false};
+    std::atomic<bool> running_{false};
+    std::atomic<uint64_t> live_spooled_{0};     // spooled while connected, see DrainBudget
+    uint64_t failed_attempts_{0};       // in the current outage
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::thread thread_;
+
+    Gauge& connected_gauge_;
+    Counter& connects_;
+    Counter& dropped_;
+};
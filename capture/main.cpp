@@ -0,0 +1,324 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+#include <atomic>
+#include <csignal>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "can/capture/candump.h"
+#include "can/capture/capture_reader.h"
+#include "can/capture/capture_recorder.h"
+#include "can/capture/capture_replayer.h"
+#include "can/capture/capture_writer.h"
+#include "can/linux/sockets/can_receiver.h"
+#include "can/linux/sockets/can_sender.h"
+#include "logging/logger.h"
+
+
+static LogModule log_module("main");
+
+namespace {
+    constexpr const char* usage =
+        "Usage:\n"
+        "  cancapture record --out DIR --interface IF [--interface IF ...] [--duration S] [--segment-mb N]\n"
+        "  cancapture replay --in DIR [--speed X | --max] [--map FROM=TO ...] [--loops N]\n"
+        "  cancapture import --in FILE.log --out DIR\n"
+        "  cancapture export --in DIR --out FILE.log\n"
+        "  cancapture info --in DIR\n";
+
+    struct Arguments {
+        std::string command;
+        std::string in;
+        std::string out;
+        std::vector<std::string> interfaces;
+        std::map<std::string, std::string> map;
+        double speed{1.0};
+        size_t loops{1};
+        uint64_t duration_s{0};
+        uint64_t segment_mb{64};
+    };
+
+    std::atomic<bool> stop_requested{false};
+    std::atomic<CaptureReplayer*> active_replayer{nullptr};
+
+    void signal_handler(int) {
+        stop_requested.store(true);
+        if (auto* replayer = active_replayer.load()) {
+            replayer->stop();
+        }
+    }
+
+    std::optional<Arguments> parse_args(int argc, char* argv[]) {
+        if (argc < 2) {
+            return std::nullopt;
+        }
+
+        Arguments args;
+        args.command = argv[1];
+        for (int i = 2; i < argc; ++i) {
+            const std::string_view arg = argv[i];
+            const bool has_value = i + 1 < argc;
+            if (arg == "--max") {
+                args.speed = 0.0;
+            } else if (!has_value) {
+                LOG_ERROR(log_module, "{} requires an argument", arg);
+                return std::nullopt;
+            } else if (arg == "--in") {
+                args.in = argv[++i];
+            } else if (arg == "--out") {
+                args.out = argv[++i];
+            } else if (arg == "--interface") {
+                args.interfaces.emplace_back(argv[++i]);
+            } else if (arg == "--speed") {
+                args.speed = std::stod(argv[++i]);
+            } else if (arg == "--loops") {
+                args.loops = std::stoul(argv[++i]);
+            } else if (arg == "--duration") {
+                args.duration_s = std::stoull(argv[++i]);
+            } else if (arg == "--segment-mb") {
+                args.segment_mb = std::stoull(argv[++i]);
+            } else if (arg == "--map") {
+                const std::string_view mapping = argv[++i];
+                const auto eq = mapping.find('=');
+                if (eq == std::string_view::npos) {
+                    LOG_ERROR(log_module, "--map expects FROM=TO");
+                    return std::nullopt;
+                }
+                args.map[std::string(mapping.substr(0, eq))] = std::string(mapping.substr(eq + 1));
+            } else {
+                LOG_ERROR(log_module, "Unknown argument {}", arg);
+                return std::nullopt;
+            }
+        }
+        return args;
+    }
+
+    uint64_t segment_records(uint64_t segment_mb) {
+        return std::max<uint64_t>(segment_mb * 1024 * 1024 / sizeof(CaptureRecord), 1);
+    }
+
+    int record(const Arguments& args) {
+        if (args.out.empty() || args.interfaces.empty()) {
+            LOG_ERROR(log_module, "record needs --out and at least one --interface");
+            return 1;
+        }
+
+        CaptureRecorder::Options options;
+        options.directory = args.out;
+        options.segment_records = segment_records(args.segment_mb);
+        CaptureRecorder recorder(options);
+        if (!recorder.start()) {
+            return 1;
+        }
+
+        CanReceiveOptions receive;
+        receive.batch_size = 64;
+        receive.max_wait = std::chrono::microseconds(1000);
+        receive.kernel_timestamps = true;
+        std::vector<std::shared_ptr<LinuxSocketCanReceiver>> receivers;
+        for (const auto& name : args.interfaces) {
+            auto receiver = std::make_shared<LinuxSocketCanReceiver>(name, receive);
+            if (!recorder.add(*receiver) || !receiver->open() || !receiver->start()) {
+                LOG_ERROR(log_module, "Failed to record {}", name);
+                return 1;
+            }
+            receivers.push_back(std::move(receiver));
+        }
+
+        const auto until = std::chrono::steady_clock::now() + std::chrono::seconds(args.duration_s);
+        while (!stop_requested.load() && (args.duration_s == 0 || std::chrono::steady_clock::now() < until)) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        }
+
+        for (const auto& receiver : receivers) {
+            receiver->stop();
+            receiver->wait();
+            receiver->close();
+        }
+        recorder.stop();
+        return 0;
+    }
+
+    int replay(const Arguments& args) {
+        CaptureReader reader;
+        if (args.in.empty() || !reader.open(args.in)) {
+            LOG_ERROR(log_module, "replay needs a capture directory in --in");
+            return 1;
+        }
+
+        CaptureReplayer::Options options;
+        options.speed = args.speed;
+        options.interfaces = args.map;
+        options.loops = args.loops;
+
+        std::map<std::string, std::shared_ptr<ICanSender>> senders;
+        for (const auto& name : reader.interfaces()) {
+            auto it = args.map.find(name);
+            const auto target = it != args.map.end() ? it->second : name;
+            if (senders.count(target)) {
+                continue;
+            }
+            auto sender = std::make_shared<LinuxSocketCanSender>(target);
+            if (!sender->open()) {
+                LOG_ERROR(log_module, "Failed to open {}", target);
+                return 1;
+            }
+            senders[target] = std::move(sender);
+        }
+
+        CaptureReplayer replayer(options, senders);
+        active_replayer.store(&replayer);
+        if (stop_requested.load()) {
+            return 0;
+        }
+        const auto stats = replayer.run(reader);
+        active_replayer.store(nullptr);
+        return stats.failed == 0 ? 0 : 2;
+    }
+
+    int import_candump(const Arguments& args) {
+        std::ifstream in(args.in);
+        if (!in || args.out.empty()) {
+            LOG_ERROR(log_module, "import needs a readable --in log and --out");
+            return 1;
+        }
+
+        CaptureWriter writer(CaptureWriter::Options{args.out, segment_records(args.segment_mb)});
+        if (!writer.open()) {
+            return 1;
+        }
+
+        std::vector<CaptureRecord> batch;
+        std::string line;
+        size_t line_number = 0;
+        size_t invalid = 0;
+        while (std::getline(in, line)) {
+            ++line_number;
+            if (line.empty()) {
+                continue;
+            }
+            auto parsed = parse_candump_line(line);
+            const auto interface = parsed ? writer.interface_index(parsed->interface) : std::nullopt;
+            if (!interface) {
+                if (invalid++ < 10) {
+                    LOG_WARN(log_module, "Line {} skipped: {}", line_number, line);
+                }
+                continue;
+            }
+            batch.push_back(to_capture_record(parsed->frame, *interface, parsed->timestamp_ns));
+            if (batch.size() == 4096) {
+                if (!writer.append(batch)) {
+                    return 1;
+                }
+                batch.clear();
+            }
+        }
+        if (!writer.append(batch)) {
+            return 1;
+        }
+        writer.close();
+        LOG_INFO(log_module, "Imported {} frames from {}, {} lines skipped", writer.records(), args.in, invalid);
+        return 0;
+    }
+
+    int export_candump(const Arguments& args) {
+        CaptureReader reader;
+        if (args.in.empty() || !reader.open(args.in)) {
+            LOG_ERROR(log_module, "export needs a capture directory in --in");
+            return 1;
+        }
+        std::ofstream out(args.out);
+        if (args.out.empty() || !out) {
+            LOG_ERROR(log_module, "export needs a writable --out file");
+            return 1;
+        }
+
+        const auto& interfaces = reader.interfaces();
+        uint64_t count = 0;
+        for (size_t s = 0; s < reader.segments().size(); ++s) {
+            for (const auto& record : reader.map(s)) {
+                const auto& name = record.interface < interfaces.size() ? interfaces[record.interface] : std::string("?");
+                out << format_candump_line(record.timestamp_ns, name, to_can_frame(record)) << '\n';
+                ++count;
+            }
+        }
+        LOG_INFO(log_module, "Exported {} frames to {}", count, args.out);
+        return out ? 0 : 1;
+    }
+
+    int info(const Arguments& args) {
+        CaptureReader reader;
+        if (args.in.empty() || !reader.open(args.in)) {
+            LOG_ERROR(log_module, "info needs a capture directory in --in");
+            return 1;
+        }
+
+        std::string interfaces;
+        for (const auto& name : reader.interfaces()) {
+            interfaces += (interfaces.empty() ? "" : ", ") + name;
+        }
+        const double seconds = static_cast<double>(reader.last_ns() - reader.first_ns()) / 1e9;
+        std::printf("%s: %llu frames in %zu segment(s), %.3f s, interfaces: %s\n", args.in.c_str(),
+                    static_cast<unsigned long long>(reader.records()), reader.segments().size(), seconds, interfaces.c_str());
+        for (const auto& segment : reader.segments()) {
+            std::printf("  %s: %llu frames, %.3f s\n", segment.path.c_str(), static_cast<unsigned long long>(segment.records),
+                        static_cast<double>(segment.last_ns - segment.first_ns) / 1e9);
+        }
+        return 0;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    std::setvbuf(stdout, nullptr, _IOLBF, 0);
+    std::setvbuf(stderr, nullptr, _IOLBF, 0);
+    signal(SIGTERM, signal_handler);
+    signal(SIGINT, signal_handler);
+
+    auto args = parse_args(argc, argv);
+    int rc = 1;
+    if (!args) {
+        std::fputs(usage, stderr);
+    } else if (args->command == "record") {
+        rc = record(*args);
+    } else if (args->command == "replay") {
+        rc = replay(*args);
+    } else if (args->command == "import") {
+        rc = import_candump(*args);
+    } else if (args->command == "export") {
+        rc = export_candump(*args);
+    } else if (args->command == "info") {
+        rc = info(*args);
+    } else {
+        std::fputs(usage, stderr);
+    }
+    Logger::instance().flush();
+    return rc;
+}
@@ -23,14 +23,68 @@
 
 #pragma once
 
+#include <array>
+#include <charconv>
+#include <cstddef>
 #include <cstdint>
-#include <vector>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <type_traits>
 
 struct CanFrame {
-    uint32_t id;                    // 11-bit (standard) or 29-bit (extended)
-    std::vector<uint8_t> data;      // 0 .. 8 bytes (CAN), up to 64 for CAN-FD
-    bool is_extended{false};        // true if this is an extended frame (29-bit ID)
-    bool is_fd{false};              // true if this is a CAN-FD frame
-    bool is_rtr{false};             // true if this is a Remote Transmission Request frame
+    static constexpr size_t max_data_len = 64;  // CAN-FD maximum payload
+
+    uint32_t id{0};                             // 11-bit (standard) or 29-bit (extended)
+    uint8_t len{0};                             // 0 .. 8 bytes (CAN), up to 64 for CAN-FD
+    bool is_extended{false};                    // true if this is an extended frame (29-bit ID)
+    bool is_fd{false};                          // true if this is a CAN-FD frame
+    bool is_brs{false};                         // CAN-FD only: data phase sent with bit rate switch
+    bool is_esi{false};                         // CAN-FD only: transmitter was error passive
+    bool is_rtr{false};                         // true if this is a Remote Transmission Request frame
+    uint64_t timestamp_ns{0};                   // receive time in ns since Unix epoch, 0 when not captured
+    std::array<uint8_t, max_data_len> data{};   // payload, only the first `len` bytes are valid
+
+    size_t size() const { return len; }
+
+    std::span<const uint8_t> payload() const { return {data.data(), len}; }
+
+    // Copies `bytes` into the inline buffer, truncating at max_data_len
+    void set_payload(std::span<const uint8_t> bytes)
+    {
+        len = static_cast<uint8_t>(bytes.size() < max_data_len ? bytes.size() : max_data_len);
+        std::memcpy(data.data(), bytes.data(), len);
+    }
 };
 
+// Smallest valid CAN-FD payload length (0..8, 12, 16, 20, 24, 32, 48, 64) that holds `len` bytes
+constexpr uint8_t can_fd_round_up_len(size_t len)
+{
+    constexpr uint8_t lengths[] = {12, 16, 20, 24, 32, 48, 64};
+    if (len <= 8)
+        return static_cast<uint8_t>(len);
+    for (uint8_t l : lengths)
+        if (len <= l)
+            return l;
+    return CanFrame::max_data_len;
+}
+
+constexpr uint32_t can_max_standard_id = 0x7FF;        // 11-bit
+constexpr uint32_t can_max_extended_id = 0x1FFFFFFF;   // 29-bit
+
+// Hex CAN ID or mask as written in config files, "0x7FF" or "7FF". nullopt unless the
+// whole text is hex and fits in 29 bits.
+inline std::optional<uint32_t> parse_can_id(std::string_view text)
+{
+    if (text.starts_with("0x") || text.starts_with("0X"))
+        text.remove_prefix(2);
+    uint32_t id = 0;
+    const auto [end, ec] = std::from_chars(text.data(), text.data() + text.size(), id, 16);
+    if (text.empty() || ec != std::errc{} || end != text.data() + text.size() || id > can_max_extended_id)
+        return std::nullopt;
+    return id;
+}
+
+// Frames are passed by value through rings and batch arrays, keep them plain data
+static_assert(std::is_trivially_copyable_v<CanFrame>);
@@ -0,0 +1,178 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+#include "can/capture/candump.h"
+
+#include <charconv>
+#include <cstdio>
+
+
+namespace {
+    int hex_digit(char c)
+    {
+        if (c >= '0' && c <= '9') return c - '0';
+        if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+        if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+        return -1;
+    }
+
+    bool parse_hex_bytes(std::string_view text, CanFrame& frame, size_t max_len)
+    {
+        size_t len = 0;
+        for (size_t i = 0; i < text.size(); ) {
+            if (text[i] == '.') {
+                ++i;
+                continue;
+            }
+            if (text[i] == '_') {
+                break;      // "_<dlc>" suffix of classic frames with a DLC above 8
+            }
+            if (i + 1 >= text.size() || len >= max_len) {
+                return false;
+            }
+            const int hi = hex_digit(text[i]);
+            const int lo = hex_digit(text[i + 1]);
+            if (hi < 0 || lo < 0) {
+                return false;
+            }
+            frame.data[len++] = static_cast<uint8_t>(hi << 4 | lo);
+            i += 2;
+        }
+        frame.len = static_cast<uint8_t>(len);
+        return true;
+    }
+
+    std::string_view next_token(std::string_view& line)
+    {
+        const size_t begin = line.find_first_not_of(" \t\r");
+        if (begin == std::string_view::npos) {
+            line = {};
+            return {};
+        }
+        const size_t end = line.find_first_of(" \t\r", begin);
+        const auto token = line.substr(begin, end == std::string_view::npos ? std::string_view::npos : end - begin);
+        line = end == std::string_view::npos ? std::string_view{} : line.substr(end);
+        return token;
+    }
+}
+
+std::optional<CandumpLine> parse_candump_line(std::string_view line)
+{
+    CandumpLine result;
+
+    // "(seconds.fraction)", any number of fraction digits
+    const auto stamp = next_token(line);
+    if (stamp.size() < 3 || stamp.front() != '(' || stamp.back() != ')') {
+        return std::nullopt;
+    }
+    const auto dot = stamp.find('.');
+    uint64_t seconds = 0;
+    const auto seconds_end = stamp.data() + (dot == std::string_view::npos ? stamp.size() - 1 : dot);
+    if (std::from_chars(stamp.data() + 1, seconds_end, seconds).ptr != seconds_end) {
+        return std::nullopt;
+    }
+    uint64_t fraction_ns = 0;
+    if (dot != std::string_view::npos) {
+        uint64_t scale = 100000000;
+        for (size_t i = dot + 1; i + 1 < stamp.size(); ++i) {
+            const int d = stamp[i] - '0';
+            if (d < 0 || d > 9) {
+                return std::nullopt;
+            }
+            fraction_ns += static_cast<uint64_t>(d) * scale;
+            scale /= 10;
+        }
+    }
+    result.timestamp_ns = seconds * 1000000000ull + fraction_ns;
+
+    result.interface = std::string(next_token(line));
+    const auto frame = next_token(line);
+    const auto hash = frame.find('#');
+    if (result.interface.empty() || hash == std::string_view::npos || hash == 0) {
+        return std::nullopt;
+    }
+
+    auto& f = result.frame;
+    const auto id = frame.substr(0, hash);
+    if (std::from_chars(id.data(), id.data() + id.size(), f.id, 16).ptr != id.data() + id.size()) {
+        return std::nullopt;
+    }
+    f.is_extended = id.size() > 3;
+
+    auto payload = frame.substr(hash + 1);
+    if (!payload.empty() && payload.front() == '#') {
+        // CAN-FD: flags digit, then up to 64 data bytes
+        if (payload.size() < 2 || hex_digit(payload[1]) < 0) {
+            return std::nullopt;
+        }
+        const int flags = hex_digit(payload[1]);
+        f.is_fd = true;
+        f.is_brs = flags & 1;
+        f.is_esi = flags & 2;
+        if (!parse_hex_bytes(payload.substr(2), f, CanFrame::max_data_len)) {
+            return std::nullopt;
+        }
+        f.len = can_fd_round_up_len(f.len);
+        return result;
+    }
+
+    if (!payload.empty() && (payload.front() == 'R' || payload.front() == 'r')) {
+        f.is_rtr = true;
+        f.len = payload.size() > 1 && payload[1] >= '0' && payload[1] <= '8' ? static_cast<uint8_t>(payload[1] - '0') : 0;
+        return result;
+    }
+
+    if (!parse_hex_bytes(payload, f, 8)) {
+        return std::nullopt;
+    }
+    return result;
+}
+
+std::string format_candump_line(uint64_t timestamp_ns, std::string_view interface, const CanFrame& frame)
+{
+    static constexpr char digits[] = "0123456789ABCDEF";
+
+    char head[64];
+    const int n = std::snprintf(head, sizeof(head), "(%010llu.%06llu) ",
+                                static_cast<unsigned long long>(timestamp_ns / 1000000000ull),
+                                static_cast<unsigned long long>(timestamp_ns % 1000000000ull / 1000));
+    std::string out(head, static_cast<size_t>(n));
+    out.append(interface);
+
+    std::snprintf(head, sizeof(head), frame.is_extended ? " %08X#" : " %03X#", frame.id);
+    out.append(head);
+    if (frame.is_fd) {
+        out.push_back('#');
+        out.push_back(digits[(frame.is_brs ? 1 : 0) | (frame.is_esi ? 2 : 0)]);
+    } else if (frame.is_rtr) {
+        out.push_back('R');
+        if (frame.len > 0) {
+            out.push_back(static_cast<char>('0' + frame.len));
+        }
+        return out;
+    }
+    for (size_t i = 0; i < frame.len; ++i) {
+        out.push_back(digits[frame.data[i] >> 4]);
+        out.push_back(digits[frame.data[i] & 0xF]);
+    }
+    return out;
+}
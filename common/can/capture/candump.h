@@ -0,0 +1,44 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "can/can_frame.h"
+
+
+// Log lines of candump -l / canplayer: "(1436509052.249713) vcan0 123#DEADBEEF".
+// Extended IDs have 8 hex digits, "123#R" is a remote frame and "123##1DEADBEEF" a CAN-FD frame
+// whose first hex digit holds the flags (1 = bit rate switch, 2 = error state indicator).
+struct CandumpLine {
+    uint64_t timestamp_ns{0};
+    std::string interface;
+    CanFrame frame;
+};
+
+std::optional<CandumpLine> parse_candump_line(std::string_view line);
+
+std::string format_candump_line(uint64_t timestamp_ns, std::string_view interface, const CanFrame& frame);
@@ -0,0 +1,130 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+#include "can/can_frame.h"
+
+
+// On-disk layout of CAN captures. A capture is a directory of segment files
+// (segment-000001.cap, ...) plus an "index" file. A segment is a fixed 512-byte header followed
+// by fixed-size records, so a mapped segment is an array of CaptureRecord and record i sits at
+// header_size + i * record_size. A segment cut short by a crash is still readable up to its last
+// complete record. All fields are little endian.
+
+constexpr char capture_magic[8] = {'C', 'A', 'N', 'C', 'A', 'P', '\0', '\1'};
+constexpr char capture_index_magic[8] = {'C', 'A', 'N', 'I', 'D', 'X', '\0', '\1'};
+constexpr uint32_t capture_version = 1;
+constexpr size_t capture_max_interfaces = 16;
+constexpr size_t capture_interface_name_len = 16;     // IFNAMSIZ
+
+enum CaptureFlags : uint8_t {
+    capture_extended = 1 << 0,
+    capture_fd = 1 << 1,
+    capture_brs = 1 << 2,
+    capture_esi = 1 << 3,
+    capture_rtr = 1 << 4,
+};
+
+struct CaptureRecord {
+    uint64_t timestamp_ns;      // kernel receive time when available, else wall clock at reception
+    uint32_t id;
+    uint8_t flags;              // CaptureFlags
+    uint8_t len;
+    uint8_t interface;          // into CaptureSegmentHeader::interfaces
+    uint8_t reserved;
+    uint8_t data[CanFrame::max_data_len];
+};
+
+struct CaptureSegmentHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t header_size;
+    uint32_t record_size;
+    uint32_t interface_count;
+    uint64_t sequence;          // segment number, starting at 1
+    uint64_t created_ns;
+    uint8_t reserved[216];
+    char interfaces[capture_max_interfaces][capture_interface_name_len];   // NUL padded
+};
+
+// The index file holds this header and one entry per closed segment. It is rewritten on every
+// segment rotation, so the segment being written may be missing from it.
+struct CaptureIndexHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t entry_count;
+};
+
+struct CaptureIndexEntry {
+    uint64_t sequence;
+    uint64_t first_ns;
+    uint64_t last_ns;
+    uint64_t records;
+};
+
+static_assert(sizeof(CaptureRecord) == 80);
+static_assert(sizeof(CaptureSegmentHeader) == 512);
+static_assert(std::is_trivially_copyable_v<CaptureRecord>);
+
+inline CaptureRecord to_capture_record(const CanFrame& frame, uint8_t interface, uint64_t timestamp_ns)
+{
+    CaptureRecord record{};
+    record.timestamp_ns = timestamp_ns;
+    record.id = frame.id;
+    record.flags = static_cast<uint8_t>((frame.is_extended ? capture_extended : 0) | (frame.is_fd ? capture_fd : 0)
+                                        | (frame.is_brs ? capture_brs : 0) | (frame.is_esi ? capture_esi : 0)
+                                        | (frame.is_rtr ? capture_rtr : 0));
+    record.len = frame.len;
+    record.interface = interface;
+    std::memcpy(record.data, frame.data.data(), frame.len);
+    return record;
+}
+
+inline CanFrame to_can_frame(const CaptureRecord& record)
+{
+    CanFrame frame;
+    frame.id = record.id;
+    frame.len = record.len <= CanFrame::max_data_len ? record.len : CanFrame::max_data_len;
+    frame.is_extended = record.flags & capture_extended;
+    frame.is_fd = record.flags & capture_fd;
+    frame.is_brs = record.flags & capture_brs;
+    frame.is_esi = record.flags & capture_esi;
+    frame.is_rtr = record.flags & capture_rtr;
+    frame.timestamp_ns = record.timestamp_ns;
+    std::memcpy(frame.data.data(), record.data, frame.len);
+    return frame;
+}
+
+inline std::string capture_segment_name(uint64_t sequence)
+{
+    char name[32];
+    std::snprintf(name, sizeof(name), "segment-%06llu.cap", static_cast<unsigned long long>(sequence));
+    return name;
+}
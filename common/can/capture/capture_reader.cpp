@@ -0,0 +1,212 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+#include "can/capture/capture_reader.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "logging/logger.h"
+
+
+static LogModule log_module("capture");
+
+namespace {
+    std::vector<CaptureIndexEntry> read_index(const std::filesystem::path& path)
+    {
+        std::vector<CaptureIndexEntry> entries;
+        std::ifstream file(path, std::ios::binary);
+        CaptureIndexHeader header{};
+        if (!file.read(reinterpret_cast<char*>(&header), sizeof(header))
+            || std::memcmp(header.magic, capture_index_magic, sizeof(header.magic)) != 0 || header.version != capture_version) {
+            return entries;
+        }
+        entries.resize(header.entry_count);
+        if (!file.read(reinterpret_cast<char*>(entries.data()), static_cast<std::streamsize>(entries.size() * sizeof(CaptureIndexEntry)))) {
+            entries.clear();
+        }
+        return entries;
+    }
+}
+
+CaptureReader::~CaptureReader()
+{
+    unmap();
+}
+
+bool CaptureReader::open(const std::string& directory)
+{
+    directory_ = directory;
+    segments_.clear();
+    interfaces_.clear();
+    unmap();
+
+    std::error_code ec;
+    std::vector<std::filesystem::path> paths;
+    for (const auto& entry : std::filesystem::directory_iterator(directory, ec)) {
+        const auto name = entry.path().filename().string();
+        if (name.starts_with("segment-") && name.ends_with(".cap")) {
+            paths.push_back(entry.path());
+        }
+    }
+    if (ec || paths.empty()) {
+        LOG_ERROR(log_module, "No capture segments in {}", directory);
+        return false;
+    }
+    std::sort(paths.begin(), paths.end());
+
+    const auto index = read_index(std::filesystem::path(directory) / "index");
+    for (const auto& path : paths) {
+        Segment segment;
+        segment.path = path.string();
+        if (!read_segment(segment, index)) {
+            return false;
+        }
+        segments_.push_back(std::move(segment));
+    }
+    return true;
+}
+
+bool CaptureReader::read_segment(Segment& segment, const std::vector<CaptureIndexEntry>& index)
+{
+    const int fd = ::open(segment.path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        LOG_ERROR(log_module, "Failed to open {}: {}", segment.path, std::strerror(errno));
+        return false;
+    }
+
+    CaptureSegmentHeader header{};
+    struct stat st{};
+    const bool ok = ::pread(fd, &header, sizeof(header), 0) == static_cast<ssize_t>(sizeof(header)) && ::fstat(fd, &st) == 0;
+    ::close(fd);
+    if (!ok || std::memcmp(header.magic, capture_magic, sizeof(header.magic)) != 0 || header.version != capture_version
+        || header.header_size != sizeof(CaptureSegmentHeader) || header.record_size != sizeof(CaptureRecord)
+        || header.interface_count > capture_max_interfaces) {
+        LOG_ERROR(log_module, "{} is not a capture segment of version {}", segment.path, capture_version);
+        return false;
+    }
+
+    segment.sequence = header.sequence;
+    segment.records = (static_cast<uint64_t>(st.st_size) - header.header_size) / header.record_size;
+    if (header.interface_count >= interfaces_.size()) {
+        interfaces_.clear();
+        for (uint32_t i = 0; i < header.interface_count; ++i) {
+            interfaces_.emplace_back(header.interfaces[i], strnlen(header.interfaces[i], capture_interface_name_len));
+        }
+    }
+
+    auto it = std::find_if(index.begin(), index.end(), [&](const CaptureIndexEntry& e) { return e.sequence == segment.sequence; });
+    if (it != index.end() && it->records == segment.records) {
+        segment.first_ns = it->first_ns;
+        segment.last_ns = it->last_ns;
+        return true;
+    }
+
+    // Not in the index yet, the time range comes from the records themselves
+    const auto records = map_segment(segment);
+    for (size_t i = 0; i < records.size(); ++i) {
+        segment.first_ns = i == 0 ? records[i].timestamp_ns : std::min(segment.first_ns, records[i].timestamp_ns);
+        segment.last_ns = std::max(segment.last_ns, records[i].timestamp_ns);
+    }
+    unmap();
+    return true;
+}
+
+uint64_t CaptureReader::records() const
+{
+    uint64_t total = 0;
+    for (const auto& segment : segments_) {
+        total += segment.records;
+    }
+    return total;
+}
+
+uint64_t CaptureReader::first_ns() const
+{
+    uint64_t first = 0;
+    for (const auto& segment : segments_) {
+        if (segment.records > 0 && (first == 0 || segment.first_ns < first)) {
+            first = segment.first_ns;
+        }
+    }
+    return first;
+}
+
+uint64_t CaptureReader::last_ns() const
+{
+    uint64_t last = 0;
+    for (const auto& segment : segments_) {
+        last = std::max(last, segment.last_ns);
+    }
+    return last;
+}
+
+std::span<const CaptureRecord> CaptureReader::map(size_t index)
+{
+    return map_segment(segments_.at(index));
+}
+
+std::span<const CaptureRecord> CaptureReader::map_segment(const Segment& segment)
+{
+    unmap();
+    if (segment.records == 0) {
+        return {};
+    }
+
+    const int fd = ::open(segment.path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        LOG_ERROR(log_module, "Failed to open {}: {}", segment.path, std::strerror(errno));
+        return {};
+    }
+    const size_t size = sizeof(CaptureSegmentHeader) + segment.records * sizeof(CaptureRecord);
+    void* p = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (p == MAP_FAILED) {
+        LOG_ERROR(log_module, "Failed to map {}: {}", segment.path, std::strerror(errno));
+        return {};
+    }
+
+    // Records are read front to back, let the kernel read ahead
+    ::madvise(p, size, MADV_SEQUENTIAL);
+    ::madvise(p, size, MADV_WILLNEED);
+    mapping_ = p;
+    mapping_size_ = size;
+    const auto* records = reinterpret_cast<const CaptureRecord*>(static_cast<const uint8_t*>(p) + sizeof(CaptureSegmentHeader));
+    return {records, segment.records};
+}
+
+void CaptureReader::unmap()
+{
+    if (mapping_) {
+        ::munmap(mapping_, mapping_size_);
+        mapping_ = nullptr;
+        mapping_size_ = 0;
+    }
+}
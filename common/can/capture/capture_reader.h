@@ -0,0 +1,77 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "can/capture/capture_format.h"
+
+
+// Read access to a capture directory. Segments are memory mapped one at a time; segments the
+// index does not cover yet (the last one after a crash) are scanned for their time range.
+class CaptureReader
+{
+public:
+    struct Segment {
+        std::string path;
+        uint64_t sequence{0};
+        uint64_t first_ns{0};
+        uint64_t last_ns{0};
+        uint64_t records{0};
+    };
+
+    CaptureReader() = default;
+    ~CaptureReader();
+
+    CaptureReader(const CaptureReader&) = delete;
+    CaptureReader& operator=(const CaptureReader&) = delete;
+
+    bool open(const std::string& directory);
+
+    const std::vector<Segment>& segments() const { return segments_; }
+
+    // Interface table of the newest segment, earlier segments use a prefix of it
+    const std::vector<std::string>& interfaces() const { return interfaces_; }
+
+    uint64_t records() const;
+    uint64_t first_ns() const;
+    uint64_t last_ns() const;
+
+    // Maps segment `index` read-only. The span stays valid until the next map() call.
+    std::span<const CaptureRecord> map(size_t index);
+
+private:
+    bool read_segment(Segment& segment, const std::vector<CaptureIndexEntry>& index);
+    std::span<const CaptureRecord> map_segment(const Segment& segment);
+    void unmap();
+
+private:
+    std::string directory_;
+    std::vector<Segment> segments_;
+    std::vector<std::string> interfaces_;
+    void* mapping_{nullptr};
+    size_t mapping_size_{0};
+};
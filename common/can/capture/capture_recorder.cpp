@@ -0,0 +1,170 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+#include "can/capture/capture_recorder.h"
+
+#include <algorithm>
+#include <ctime>
+#include <filesystem>
+
+#include "logging/logger.h"
+
+
+static LogModule log_module("capture");
+
+CaptureRecorder::Options CaptureRecorder::parse_options(const nlohmann::json& config)
+{
+    Options options;
+    if (!config.value("enabled", true) || !config.contains("directory")) {
+        return options;
+    }
+
+    const std::time_t now = std::time(nullptr);
+    std::tm utc{};
+    gmtime_r(&now, &utc);
+    char run[32];
+    std::strftime(run, sizeof(run), "%Y%m%d-%H%M%S", &utc);
+
+    options.directory = (std::filesystem::path(config["directory"].get<std::string>()) / run).string();
+    const uint64_t segment_mb = config.value("segment_mb", uint64_t{64});
+    options.segment_records = std::max<uint64_t>(segment_mb * 1024 * 1024 / sizeof(CaptureRecord), 1);
+    options.max_pending = config.value("max_pending", options.max_pending);
+    return options;
+}
+
+CaptureRecorder::CaptureRecorder(Options options)
+    : options_(std::move(options))
+    , writer_(CaptureWriter::Options{options_.directory, options_.segment_records})
+    , recorded_(MetricsRegistry::instance().counter("capture_records_total", "CAN frames written to the capture"))
+    , dropped_(MetricsRegistry::instance().counter("capture_dropped_total", "CAN frames dropped because the capture writer fell behind"))
+{
+    pending_.reserve(options_.max_pending);
+}
+
+CaptureRecorder::~CaptureRecorder()
+{
+    stop();
+}
+
+bool CaptureRecorder::start()
+{
+    if (!writer_.open()) {
+        return false;
+    }
+
+    running_ = true;
+    thread_ = std::thread(&CaptureRecorder::write_loop, this);
+    LOG_INFO(log_module, "Recording CAN frames to {}", options_.directory);
+    return true;
+}
+
+bool CaptureRecorder::add(ICanReceiver& receiver)
+{
+    std::optional<uint8_t> interface;
+    {
+        std::lock_guard lock(writer_mutex_);
+        interface = writer_.interface_index(receiver.name());
+    }
+    if (!interface) {
+        return false;
+    }
+
+    subscriptions_.push_back(receiver.subscribe_batch([this, index = *interface](std::span<const CanFrame> frames) {
+        record(index, frames);
+    }));
+    return true;
+}
+
+void CaptureRecorder::stop()
+{
+    subscriptions_.clear();
+    {
+        std::lock_guard lock(mutex_);
+        if (!running_) {
+            return;
+        }
+        running_ = false;
+    }
+    cv_.notify_one();
+    thread_.join();
+    writer_.close();
+}
+
+void CaptureRecorder::record(uint8_t interface, std::span<const CanFrame> frames)
+{
+    // Frames without a kernel timestamp get the time of their batch
+    const auto now_ns = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count());
+
+    size_t dropped = 0;
+    bool wake = false;
+    {
+        std::lock_guard lock(mutex_);
+        for (const auto& frame : frames) {
+            if (pending_.size() >= options_.max_pending) {
+                ++dropped;
+                continue;
+            }
+            pending_.push_back(to_capture_record(frame, interface, frame.timestamp_ns != 0 ? frame.timestamp_ns : now_ns));
+        }
+        wake = pending_.size() >= options_.max_pending / 2;
+    }
+    if (wake) {
+        cv_.notify_one();   // write early instead of waiting for the flush interval
+    }
+    if (dropped > 0) {
+        dropped_.add(dropped);
+    }
+}
+
+void CaptureRecorder::write_loop()
+{
+    std::vector<CaptureRecord> writing;
+    writing.reserve(options_.max_pending);
+    bool running = true;
+    while (running) {
+        {
+            std::unique_lock lock(mutex_);
+            cv_.wait_for(lock, options_.flush_interval, [this] { return !running_ || pending_.size() >= options_.max_pending / 2; });
+            running = running_;
+            writing.swap(pending_);
+        }
+        if (writing.empty()) {
+            continue;
+        }
+
+        // Batches of several interfaces interleave, keep the segment in time order
+        std::stable_sort(writing.begin(), writing.end(),
+                         [](const CaptureRecord& a, const CaptureRecord& b) { return a.timestamp_ns < b.timestamp_ns; });
+        bool ok;
+        {
+            std::lock_guard lock(writer_mutex_);
+            ok = writer_.append(writing);
+        }
+        if (ok) {
+            recorded_.add(writing.size());
+        } else {
+            dropped_.add(writing.size());
+        }
+        writing.clear();
+    }
+}
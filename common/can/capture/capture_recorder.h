@@ -0,0 +1,94 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "can/capture/capture_writer.h"
+#include "can/ican_receiver.h"
+#include "metrics/metrics.h"
+
+
+// Records every frame of the subscribed receivers into a capture directory. Receive threads
+// only copy records into a pending buffer; one writer thread drains it, sorts it by timestamp
+// and appends to the segment files. When the writer falls behind by max_pending records, new
+// frames are dropped and counted rather than stalling reception.
+class CaptureRecorder
+{
+public:
+    struct Options {
+        std::string directory;
+        uint64_t segment_records{1u << 20};
+        size_t max_pending{1u << 16};
+        std::chrono::milliseconds flush_interval{100};
+
+        bool enabled() const { return !directory.empty(); }
+    };
+
+    // Reads a "capture" object: { "directory": "...", "segment_mb": 64 }. Every run records into
+    // a new subdirectory of "directory" named after its start time (UTC).
+    static Options parse_options(const nlohmann::json& config);
+
+    explicit CaptureRecorder(Options options);
+    ~CaptureRecorder();
+
+    bool start();
+
+    // Records frames of `receiver` from now on; the receiver must outlive stop()
+    bool add(ICanReceiver& receiver);
+
+    // Unsubscribes, writes what is pending and closes the capture. Receivers should be stopped
+    // first, frames of a batch that is being delivered may still arrive until then.
+    void stop();
+
+    const std::string& directory() const { return options_.directory; }
+
+private:
+    void record(uint8_t interface, std::span<const CanFrame> frames);
+    void write_loop();
+
+private:
+    Options options_;
+    std::mutex writer_mutex_;       // add() may extend the interface table while the writer thread appends
+    CaptureWriter writer_;
+    std::vector<ICanReceiver::SubscriptionPtr> subscriptions_;
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::vector<CaptureRecord> pending_;
+    bool running_{false};
+    std::thread thread_;
+
+    Counter& recorded_;
+    Counter& dropped_;
+};
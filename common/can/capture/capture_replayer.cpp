@@ -0,0 +1,152 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+#include "can/capture/capture_replayer.h"
+
+#include <algorithm>
+#include <thread>
+
+#include "logging/logger.h"
+
+
+static LogModule log_module("capture");
+
+CaptureReplayer::CaptureReplayer(Options options, std::map<std::string, std::shared_ptr<ICanSender>> senders)
+    : options_(std::move(options))
+    , senders_(std::move(senders))
+    , lateness_(MetricsRegistry::instance().histogram("replay_lateness_seconds",
+                                                      "Time from a replayed frame's deadline to its send", {}, 1e-6))
+{
+    options_.max_batch = std::max<size_t>(options_.max_batch, 1);
+}
+
+std::string CaptureReplayer::target(const std::string& name) const
+{
+    auto it = options_.interfaces.find(name);
+    return it != options_.interfaces.end() ? it->second : name;
+}
+
+CaptureReplayer::Stats CaptureReplayer::run(CaptureReader& reader)
+{
+    // Capture interface index -> sender, resolved once
+    std::vector<ICanSender*> senders;
+    for (const auto& name : reader.interfaces()) {
+        auto it = senders_.find(target(name));
+        senders.push_back(it != senders_.end() ? it->second.get() : nullptr);
+        if (!senders.back()) {
+            LOG_WARN(log_module, "No sender for capture interface {}, its frames are skipped", name);
+        }
+    }
+
+    Stats stats;
+    const auto started = Clock::now();
+    running_.store(true);
+    for (size_t loop = 0; running_.load() && (options_.loops == 0 || loop < options_.loops); ++loop) {
+        play(reader, senders, stats);
+    }
+    running_.store(false);
+    stats.elapsed = Clock::now() - started;
+
+    const double seconds = std::chrono::duration<double>(stats.elapsed).count();
+    LOG_INFO(log_module, "Replayed {} frames in {:.3f} s ({:.0f} frames/s), {} failed, {} skipped",
+             stats.sent, seconds, seconds > 0 ? static_cast<double>(stats.sent) / seconds : 0.0, stats.failed, stats.skipped);
+    if (options_.speed > 0 && lateness_.count() > 0) {
+        LOG_INFO(log_module, "Send lateness p50 {} us, p99 {} us, max {} us",
+                 lateness_.quantile(0.5), lateness_.quantile(0.99), lateness_.max());
+    }
+    return stats;
+}
+
+bool CaptureReplayer::wait_until(Clock::time_point deadline) const
+{
+    auto now = Clock::now();
+    if (deadline - now > options_.spin) {
+        std::this_thread::sleep_until(deadline - options_.spin);
+    }
+    while (Clock::now() < deadline) {
+        if (!running_.load(std::memory_order_relaxed)) {
+            return false;
+        }
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#endif
+    }
+    return true;
+}
+
+void CaptureReplayer::play(CaptureReader& reader, std::span<ICanSender* const> senders, Stats& stats)
+{
+    const uint64_t base_ns = reader.first_ns();
+    const auto start = Clock::now();
+    const double speed = options_.speed;
+    auto deadline = [&](const CaptureRecord& record) {
+        if (speed <= 0 || record.timestamp_ns <= base_ns) {
+            return start;
+        }
+        const auto offset = static_cast<double>(record.timestamp_ns - base_ns) / speed;
+        return start + std::chrono::nanoseconds(static_cast<int64_t>(offset));
+    };
+
+    std::vector<std::vector<CanFrame>> batches(senders.size());
+    for (auto& batch : batches) {
+        batch.reserve(options_.max_batch);
+    }
+
+    for (size_t s = 0; s < reader.segments().size() && running_.load(); ++s) {
+        const auto records = reader.map(s);
+        for (size_t i = 0; i < records.size() && running_.load(std::memory_order_relaxed); ) {
+            if (!wait_until(deadline(records[i]))) {
+                break;
+            }
+
+            // Everything due by now leaves together
+            const auto now = Clock::now();
+            size_t taken = 0;
+            for (; i < records.size() && taken < options_.max_batch; ++i, ++taken) {
+                const auto& record = records[i];
+                const auto due = deadline(record);
+                if (due > now) {
+                    break;
+                }
+                if (record.interface >= senders.size() || !senders[record.interface]) {
+                    ++stats.skipped;
+                    continue;
+                }
+                if (speed > 0) {
+                    lateness_.record(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(now - due).count()));
+                }
+                batches[record.interface].push_back(to_can_frame(record));
+            }
+
+            for (size_t b = 0; b < batches.size(); ++b) {
+                auto& batch = batches[b];
+                if (batch.empty()) {
+                    continue;
+                }
+                const size_t sent = senders[b]->send_batch(batch);
+                stats.sent += sent;
+                stats.failed += batch.size() - sent;
+                batch.clear();
+            }
+        }
+    }
+}
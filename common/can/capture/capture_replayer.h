@@ -0,0 +1,81 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "can/capture/capture_reader.h"
+#include "can/ican_sender.h"
+#include "metrics/metrics.h"
+
+
+// Plays a capture back through ICanSenders. Every frame has an absolute deadline derived from
+// its capture timestamp, so timing errors do not add up over a long replay. The replayer sleeps
+// until shortly before a deadline and spins the rest of the way; frames that are due together
+// go out in one send_batch() per interface. Send lateness is kept in replay_lateness_seconds.
+class CaptureReplayer
+{
+public:
+    struct Options {
+        double speed{1.0};                              // 2 = twice as fast, 0 = as fast as possible
+        std::map<std::string, std::string> interfaces;  // capture interface -> send interface, default same name
+        std::chrono::microseconds spin{200};            // busy-wait this long before a deadline
+        size_t max_batch{64};
+        size_t loops{1};                                // 0 = until stopped
+    };
+
+    struct Stats {
+        uint64_t sent{0};
+        uint64_t failed{0};
+        uint64_t skipped{0};    // capture interface without a sender
+        std::chrono::nanoseconds elapsed{0};
+    };
+
+    // `senders` by send interface name
+    CaptureReplayer(Options options, std::map<std::string, std::shared_ptr<ICanSender>> senders);
+
+    // Blocks until the capture has been played `loops` times or stop() was called
+    Stats run(CaptureReader& reader);
+
+    // Signal safe
+    void stop() { running_.store(false); }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    std::string target(const std::string& name) const;
+    bool wait_until(Clock::time_point deadline) const;
+    void play(CaptureReader& reader, std::span<ICanSender* const> senders, Stats& stats);
+
+private:
+    Options options_;
+    std::map<std::string, std::shared_ptr<ICanSender>> senders_;
+    std::atomic<bool> running_{false};
+    Histogram& lateness_;
+};
@@ -0,0 +1,226 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+#include "can/capture/capture_writer.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "logging/logger.h"
+
+
+static LogModule log_module("capture");
+
+namespace {
+    bool write_all(int fd, const void* data, size_t size)
+    {
+        const auto* p = static_cast<const uint8_t*>(data);
+        while (size > 0) {
+            const ssize_t n = ::write(fd, p, size);
+            if (n < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                return false;
+            }
+            p += n;
+            size -= static_cast<size_t>(n);
+        }
+        return true;
+    }
+}
+
+CaptureWriter::CaptureWriter(Options options)
+    : options_(std::move(options))
+{
+    options_.segment_records = std::max<uint64_t>(options_.segment_records, 1);
+}
+
+CaptureWriter::~CaptureWriter()
+{
+    close();
+}
+
+bool CaptureWriter::open()
+{
+    std::error_code ec;
+    std::filesystem::create_directories(options_.directory, ec);
+    if (ec) {
+        LOG_ERROR(log_module, "Failed to create capture directory {}: {}", options_.directory, ec.message());
+        return false;
+    }
+    if (std::filesystem::exists(std::filesystem::path(options_.directory) / capture_segment_name(1))) {
+        LOG_ERROR(log_module, "{} already holds a capture", options_.directory);
+        return false;
+    }
+    return open_segment();
+}
+
+void CaptureWriter::close()
+{
+    if (fd_ < 0) {
+        return;
+    }
+    close_segment();
+    write_index();
+    LOG_INFO(log_module, "Capture {} closed: {} records in {} segment(s)", options_.directory, total_records_, sequence_);
+}
+
+std::optional<uint8_t> CaptureWriter::interface_index(const std::string& name)
+{
+    auto it = std::find(interfaces_.begin(), interfaces_.end(), name);
+    if (it != interfaces_.end()) {
+        return static_cast<uint8_t>(it - interfaces_.begin());
+    }
+    if (interfaces_.size() >= capture_max_interfaces || name.size() >= capture_interface_name_len) {
+        LOG_ERROR(log_module, "Cannot add interface {} to the capture", name);
+        return std::nullopt;
+    }
+
+    interfaces_.push_back(name);
+    if (fd_ >= 0) {
+        write_header();
+    }
+    return static_cast<uint8_t>(interfaces_.size() - 1);
+}
+
+bool CaptureWriter::append(std::span<const CaptureRecord> records)
+{
+    while (!records.empty()) {
+        if (fd_ < 0) {
+            return false;
+        }
+        if (current_.records >= options_.segment_records) {
+            if (!close_segment() || !write_index() || !open_segment()) {
+                return false;
+            }
+        }
+
+        const size_t count = std::min<uint64_t>(records.size(), options_.segment_records - current_.records);
+        const auto chunk = records.first(count);
+        if (!write_all(fd_, chunk.data(), chunk.size_bytes())) {
+            LOG_ERROR(log_module, "Failed to write capture segment {}: {}", sequence_, std::strerror(errno));
+            return false;
+        }
+
+        if (current_.records == 0) {
+            current_.first_ns = chunk.front().timestamp_ns;
+        }
+        for (const auto& record : chunk) {
+            current_.first_ns = std::min(current_.first_ns, record.timestamp_ns);
+            current_.last_ns = std::max(current_.last_ns, record.timestamp_ns);
+        }
+        current_.records += count;
+        total_records_ += count;
+        records = records.subspan(count);
+    }
+    return true;
+}
+
+bool CaptureWriter::open_segment()
+{
+    ++sequence_;
+    const auto path = std::filesystem::path(options_.directory) / capture_segment_name(sequence_);
+    fd_ = ::open(path.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+    if (fd_ < 0) {
+        LOG_ERROR(log_module, "Failed to create {}: {}", path.string(), std::strerror(errno));
+        return false;
+    }
+
+    std::memset(&header_, 0, sizeof(header_));
+    std::memcpy(header_.magic, capture_magic, sizeof(header_.magic));
+    header_.version = capture_version;
+    header_.header_size = sizeof(CaptureSegmentHeader);
+    header_.record_size = sizeof(CaptureRecord);
+    header_.sequence = sequence_;
+    header_.created_ns = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count());
+    current_ = CaptureIndexEntry{sequence_, 0, 0, 0};
+
+    // Records are appended after the header, the header itself is rewritten in place
+    if (!write_header() || ::lseek(fd_, sizeof(header_), SEEK_SET) < 0) {
+        ::close(fd_);
+        fd_ = -1;
+        return false;
+    }
+    LOG_DEBUG(log_module, "Writing {}", path.string());
+    return true;
+}
+
+bool CaptureWriter::close_segment()
+{
+    const bool ok = write_header();
+    ::close(fd_);
+    fd_ = -1;
+    index_.push_back(current_);
+    return ok;
+}
+
+bool CaptureWriter::write_header()
+{
+    header_.interface_count = static_cast<uint32_t>(interfaces_.size());
+    for (size_t i = 0; i < interfaces_.size(); ++i) {
+        std::memset(header_.interfaces[i], 0, capture_interface_name_len);
+        std::memcpy(header_.interfaces[i], interfaces_[i].data(), interfaces_[i].size());
+    }
+    if (::pwrite(fd_, &header_, sizeof(header_), 0) != static_cast<ssize_t>(sizeof(header_))) {
+        LOG_ERROR(log_module, "Failed to write header of capture segment {}: {}", sequence_, std::strerror(errno));
+        return false;
+    }
+    return true;
+}
+
+bool CaptureWriter::write_index()
+{
+    // Written next to the old index and renamed over it, readers never see a partial file
+    const auto dir = std::filesystem::path(options_.directory);
+    const auto tmp = dir / "index.tmp";
+    const int fd = ::open(tmp.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        LOG_ERROR(log_module, "Failed to write capture index: {}", std::strerror(errno));
+        return false;
+    }
+
+    CaptureIndexHeader header{};
+    std::memcpy(header.magic, capture_index_magic, sizeof(header.magic));
+    header.version = capture_version;
+    header.entry_count = static_cast<uint32_t>(index_.size());
+    const bool ok = write_all(fd, &header, sizeof(header))
+        && write_all(fd, index_.data(), index_.size() * sizeof(CaptureIndexEntry));
+    ::close(fd);
+
+    std::error_code ec;
+    if (ok) {
+        std::filesystem::rename(tmp, dir / "index", ec);
+    }
+    if (!ok || ec) {
+        LOG_ERROR(log_module, "Failed to write capture index in {}", options_.directory);
+        return false;
+    }
+    return true;
+}
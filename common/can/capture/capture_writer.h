@@ -0,0 +1,80 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "can/capture/capture_format.h"
+
+
+// Appends records to the segment files of a capture directory, starting a new segment once
+// the current one holds segment_records records. Not thread safe: CaptureRecorder funnels all
+// receive threads into one writer thread.
+class CaptureWriter
+{
+public:
+    struct Options {
+        std::string directory;
+        uint64_t segment_records{1u << 20};     // 80 MiB segments
+    };
+
+    explicit CaptureWriter(Options options);
+    ~CaptureWriter();
+
+    CaptureWriter(const CaptureWriter&) = delete;
+    CaptureWriter& operator=(const CaptureWriter&) = delete;
+
+    // Creates the directory; fails if it already holds a capture
+    bool open();
+
+    // Rewrites the header of the open segment and the index
+    void close();
+
+    // Index of `name` in the interface table, added on first use. nullopt once the table is full.
+    std::optional<uint8_t> interface_index(const std::string& name);
+
+    bool append(std::span<const CaptureRecord> records);
+
+    uint64_t records() const { return total_records_; }
+    uint64_t segments() const { return sequence_; }
+
+private:
+    bool open_segment();
+    bool close_segment();
+    bool write_header();
+    bool write_index();
+
+private:
+    Options options_;
+    int fd_{-1};
+    CaptureSegmentHeader header_{};
+    uint64_t sequence_{0};
+    CaptureIndexEntry current_{};
+    std::vector<CaptureIndexEntry> index_;
+    std::vector<std::string> interfaces_;
+    uint64_t total_records_{0};
+};
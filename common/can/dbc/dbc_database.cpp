@@ -0,0 +1,353 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+
+#include "can/dbc/dbc_database.h"
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <fstream>
+#include <sstream>
+
+#include "logging/logger.h"
+
+
+static LogModule log_module("dbc");
+
+namespace {
+    constexpr uint32_t extended_id_flag = 0x80000000u;
+    constexpr uint32_t independent_signals_id = 0xC0000000u;  // VECTOR__INDEPENDENT_SIG_MSG
+    constexpr uint32_t extended_id_mask = 0x1FFFFFFFu;
+    constexpr size_t max_payload_bits = 64 * 8;
+
+    // Whitespace separated tokens of one DBC statement
+    class Cursor
+    {
+    public:
+        explicit Cursor(std::string_view text) : text_(text) {}
+
+        bool at_end()
+        {
+            skip_space();
+            return pos_ >= text_.size();
+        }
+
+        bool consume(char c)
+        {
+            skip_space();
+            if (pos_ < text_.size() && text_[pos_] == c) {
+                ++pos_;
+                return true;
+            }
+            return false;
+        }
+
+        std::string_view word()
+        {
+            skip_space();
+            const size_t begin = pos_;
+            while (pos_ < text_.size() && (std::isalnum(static_cast<unsigned char>(text_[pos_])) || text_[pos_] == '_')) {
+                ++pos_;
+            }
+            return text_.substr(begin, pos_ - begin);
+        }
+
+        bool integer(uint64_t& value)
+        {
+            skip_space();
+            auto [end, ec] = std::from_chars(text_.data() + pos_, text_.data() + text_.size(), value);
+            if (ec != std::errc{}) {
+                return false;
+            }
+            pos_ = static_cast<size_t>(end - text_.data());
+            return true;
+        }
+
+        bool number(double& value)
+        {
+            skip_space();
+            if (pos_ < text_.size() && text_[pos_] == '+') {
+                ++pos_;
+            }
+            auto [end, ec] = std::from_chars(text_.data() + pos_, text_.data() + text_.size(), value);
+            if (ec != std::errc{}) {
+                return false;
+            }
+            pos_ = static_cast<size_t>(end - text_.data());
+            return true;
+        }
+
+        bool quoted(std::string& value)
+        {
+            if (!consume('"')) {
+                return false;
+            }
+            const size_t end = text_.find('"', pos_);
+            if (end == std::string_view::npos) {
+                return false;
+            }
+            value.assign(text_.substr(pos_, end - pos_));
+            pos_ = end + 1;
+            return true;
+        }
+
+        bool character(char& c)
+        {
+            if (pos_ >= text_.size()) {
+                return false;
+            }
+            c = text_[pos_++];
+            return true;
+        }
+
+    private:
+        void skip_space()
+        {
+            while (pos_ < text_.size() && std::isspace(static_cast<unsigned char>(text_[pos_]))) {
+                ++pos_;
+            }
+        }
+
+        std::string_view text_;
+        size_t pos_{0};
+    };
+
+    // BO_ 256 EngineData: 8 Engine
+    bool parse_message(Cursor& in, DbcMessage& message)
+    {
+        uint64_t id = 0;
+        uint64_t size = 0;
+        if (!in.integer(id)) {
+            return false;
+        }
+        message.name = in.word();
+        if (message.name.empty() || !in.consume(':') || !in.integer(size) || size > 64) {
+            return false;
+        }
+        message.is_extended = (id & extended_id_flag) != 0;
+        message.id = static_cast<uint32_t>(id & extended_id_mask);
+        message.size = static_cast<uint8_t>(size);
+        return true;
+    }
+
+    // SG_ EngineSpeed m1 : 24|16@1+ (0.125,0) [0|8031.875] "rpm" Gateway
+    bool parse_signal(Cursor& in, DbcSignal& signal)
+    {
+        signal.name = in.word();
+        if (signal.name.empty()) {
+            return false;
+        }
+
+        if (!in.consume(':')) {
+            const auto mux = in.word();
+            if (mux == "M") {
+                signal.mux = DbcSignal::Mux::Multiplexor;
+            } else if (mux.size() > 1 && mux[0] == 'm') {
+                // "m3M" (extended multiplexing) is treated as plain "m3"
+                signal.mux = DbcSignal::Mux::Multiplexed;
+                auto [end, ec] = std::from_chars(mux.data() + 1, mux.data() + mux.size(), signal.mux_value);
+                if (ec != std::errc{}) {
+                    return false;
+                }
+            } else {
+                return false;
+            }
+            if (!in.consume(':')) {
+                return false;
+            }
+        }
+
+        uint64_t start = 0;
+        uint64_t length = 0;
+        char order = 0;
+        char sign = 0;
+        if (!in.integer(start) || !in.consume('|') || !in.integer(length) || !in.consume('@')
+            || !in.character(order) || !in.character(sign)) {
+            return false;
+        }
+        if ((order != '0' && order != '1') || (sign != '+' && sign != '-')) {
+            return false;
+        }
+        if (length == 0 || length > 64 || start >= max_payload_bits) {
+            return false;
+        }
+        signal.start_bit = static_cast<uint16_t>(start);
+        signal.length = static_cast<uint16_t>(length);
+        signal.little_endian = order == '1';
+        signal.is_signed = sign == '-';
+
+        if (!in.consume('(') || !in.number(signal.factor) || !in.consume(',') || !in.number(signal.offset) || !in.consume(')')) {
+            return false;
+        }
+        if (!in.consume('[') || !in.number(signal.minimum) || !in.consume('|') || !in.number(signal.maximum) || !in.consume(']')) {
+            return false;
+        }
+        return in.quoted(signal.unit);
+    }
+
+    // SIG_VALTYPE_ 256 Temperature : 1;
+    bool parse_value_type(Cursor& in, DbcDatabase& db)
+    {
+        uint64_t id = 0;
+        uint64_t type = 0;
+        if (!in.integer(id)) {
+            return false;
+        }
+        const auto name = in.word();
+        if (!in.consume(':') || !in.integer(type) || type < 1 || type > 2) {
+            return false;
+        }
+
+        const auto can_id = static_cast<uint32_t>(id & extended_id_mask);
+        const bool is_extended = (id & extended_id_flag) != 0;
+        auto message = std::find_if(db.messages.begin(), db.messages.end(),
+            [&](const DbcMessage& m) { return m.id == can_id && m.is_extended == is_extended; });
+        if (message == db.messages.end()) {
+            return false;
+        }
+        auto it = std::find_if(message->signals.begin(), message->signals.end(), [&](const DbcSignal& s) { return s.name == name; });
+        if (it == message->signals.end() || it->length != (type == 1 ? 32 : 64)) {
+            return false;
+        }
+        it->value_type = type == 1 ? DbcSignal::ValueType::Float32 : DbcSignal::ValueType::Float64;
+        return true;
+    }
+
+    bool check_multiplexing(const DbcMessage& message)
+    {
+        const auto multiplexors = std::count_if(message.signals.begin(), message.signals.end(),
+            [](const DbcSignal& s) { return s.mux == DbcSignal::Mux::Multiplexor; });
+        const bool multiplexed = std::any_of(message.signals.begin(), message.signals.end(),
+            [](const DbcSignal& s) { return s.mux == DbcSignal::Mux::Multiplexed; });
+        return multiplexors <= 1 && (!multiplexed || multiplexors == 1);
+    }
+}
+
+const DbcMessage* DbcDatabase::find(uint32_t id, bool is_extended) const
+{
+    for (const auto& message : messages) {
+        if (message.id == id && message.is_extended == is_extended) {
+            return &message;
+        }
+    }
+    return nullptr;
+}
+
+std::optional<DbcDatabase> parse_dbc(std::string_view text)
+{
+    DbcDatabase db;
+    DbcMessage* current = nullptr;
+    bool in_string = false;     // inside a quoted string spanning lines, e.g. a CM_ comment
+    bool in_symbols = false;    // inside the indented keyword list following NS_
+    size_t line_number = 0;
+
+    for (size_t begin = 0; begin < text.size(); ) {
+        size_t end = text.find('\n', begin);
+        if (end == std::string_view::npos) {
+            end = text.size();
+        }
+        const auto line = text.substr(begin, end - begin);
+        begin = end + 1;
+        ++line_number;
+
+        const bool continuation = in_string;
+        if (std::count(line.begin(), line.end(), '"') % 2 != 0) {
+            in_string = !in_string;
+        }
+        if (continuation) {
+            continue;
+        }
+
+        const bool indented = !line.empty() && (line.front() == ' ' || line.front() == '\t');
+        if (in_symbols && (indented || line.find_first_not_of(" \t\r") == std::string_view::npos)) {
+            continue;
+        }
+        in_symbols = false;
+
+        Cursor in(line);
+        const auto keyword = in.word();
+        bool ok = true;
+        if (keyword == "NS_") {
+            in_symbols = true;
+        } else if (keyword == "BO_") {
+            DbcMessage message;
+            ok = parse_message(in, message);
+            if (ok && (message.id | (message.is_extended ? extended_id_flag : 0)) == independent_signals_id) {
+                current = nullptr;     // placeholder for unassigned signals
+                continue;
+            }
+            if (ok && db.find(message.id, message.is_extended)) {
+                LOG_ERROR(log_module, "DBC line {}: duplicate message {}", line_number, message.name);
+                return std::nullopt;
+            }
+            if (ok) {
+                db.messages.push_back(std::move(message));
+                current = &db.messages.back();
+            }
+        } else if (keyword == "SG_") {
+            DbcSignal signal;
+            ok = parse_signal(in, signal);
+            if (ok && current) {
+                current->signals.push_back(std::move(signal));
+            }
+        } else if (keyword == "SIG_VALTYPE_") {
+            ok = parse_value_type(in, db);
+        } else if (!keyword.empty()) {
+            current = nullptr;      // any other statement ends the signal list of a message
+        }
+
+        if (!ok) {
+            LOG_ERROR(log_module, "DBC line {}: cannot parse '{}'", line_number, std::string(line));
+            return std::nullopt;
+        }
+    }
+
+    for (const auto& message : db.messages) {
+        if (!check_multiplexing(message)) {
+            LOG_ERROR(log_module, "DBC message {}: needs exactly one multiplexor for its multiplexed signals", message.name);
+            return std::nullopt;
+        }
+    }
+    return db;
+}
+
+std::optional<DbcDatabase> load_dbc_file(const std::string& path)
+{
+    std::ifstream file(path);
+    if (!file) {
+        LOG_ERROR(log_module, "Failed to open DBC file: {}", path);
+        return std::nullopt;
+    }
+    std::stringstream content;
+    content << file.rdbuf();
+
+    auto db = parse_dbc(content.str());
+    if (db) {
+        size_t signals = 0;
+        for (const auto& message : db->messages) {
+            signals += message.signals.size();
+        }
+        LOG_INFO(log_module, "Loaded {}: {} messages, {} signals", path, db->messages.size(), signals);
+    }
+    return db;
+}
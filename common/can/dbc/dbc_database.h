@@ -0,0 +1,71 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+// Signal and message definitions read from a DBC file. Only what decoding and encoding need is kept:
+// BO_ (messages), SG_ (signals, incl. simple multiplexing) and SIG_VALTYPE_ (IEEE floats).
+// Attributes, comments and value tables are skipped.
+struct DbcSignal {
+    enum class ValueType : uint8_t { Integer, Float32, Float64 };
+    enum class Mux : uint8_t { None, Multiplexor, Multiplexed };
+
+    std::string name;
+    uint16_t start_bit{0};          // DBC numbering: LSB for little endian, MSB for big endian
+    uint16_t length{0};             // bits, 1 .. 64
+    bool little_endian{true};       // @1 = Intel, @0 = Motorola
+    bool is_signed{false};
+    ValueType value_type{ValueType::Integer};
+    double factor{1.0};
+    double offset{0.0};
+    double minimum{0.0};
+    double maximum{0.0};
+    std::string unit;
+    Mux mux{Mux::None};
+    uint32_t mux_value{0};          // Multiplexed only: raw multiplexor value it is present for
+};
+
+struct DbcMessage {
+    uint32_t id{0};                 // without the extended flag
+    bool is_extended{false};
+    std::string name;
+    uint8_t size{0};                // payload bytes (DLC field of BO_)
+    std::vector<DbcSignal> signals;
+};
+
+struct DbcDatabase {
+    std::vector<DbcMessage> messages;
+
+    const DbcMessage* find(uint32_t id, bool is_extended) const;
+};
+
+// Errors are logged with their line number
+std::optional<DbcDatabase> parse_dbc(std::string_view text);
+std::optional<DbcDatabase> load_dbc_file(const std::string& path);
@@ -0,0 +1,213 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+
+#include "can/dbc/dbc_decoder.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+#include "logging/logger.h"
+
+
+static LogModule log_module("dbc");
+
+namespace {
+    constexpr size_t standard_ids = 0x800;
+    constexpr size_t window_bytes = sizeof(uint64_t);
+    constexpr size_t last_window = CanFrame::max_data_len - window_bytes;
+
+    uint64_t load_le(const uint8_t* p)
+    {
+        uint64_t v;
+        std::memcpy(&v, p, sizeof(v));
+        if constexpr (std::endian::native == std::endian::big) {
+            v = __builtin_bswap64(v);
+        }
+        return v;
+    }
+
+    uint64_t load_be(const uint8_t* p)
+    {
+        uint64_t v;
+        std::memcpy(&v, p, sizeof(v));
+        if constexpr (std::endian::native == std::endian::little) {
+            v = __builtin_bswap64(v);
+        }
+        return v;
+    }
+
+    // Big endian signals in a linear numbering: bit 0 is the MSB of byte 0
+    size_t motorola_msb(uint16_t start_bit)
+    {
+        return (start_bit / 8) * 8 + (7 - start_bit % 8);
+    }
+}
+
+DbcDecoder::DbcDecoder(DbcDatabase database)
+    : database_(std::move(database))
+    , standard_(standard_ids, -1)
+{
+    for (size_t m = 0; m < database_.messages.size(); ++m) {
+        const auto& definition = database_.messages[m];
+
+        Message message{};
+        message.first = static_cast<uint32_t>(signals_.size());
+        message.count = static_cast<uint16_t>(definition.signals.size());
+        message.multiplexor = -1;
+        message.index = static_cast<uint32_t>(m);
+        for (size_t s = 0; s < definition.signals.size(); ++s) {
+            const auto& signal = definition.signals[s];
+            if (signal.mux == DbcSignal::Mux::Multiplexor) {
+                message.multiplexor = static_cast<int32_t>(s);
+            }
+            signals_.push_back(compile(signal));
+        }
+        max_signals_ = std::max<size_t>(max_signals_, message.count);
+
+        const auto index = static_cast<int32_t>(messages_.size());
+        messages_.push_back(message);
+        if (definition.is_extended) {
+            extended_[definition.id] = index;
+        } else if (definition.id < standard_ids) {
+            standard_[definition.id] = index;
+        } else {
+            LOG_WARN(log_module, "DBC message {}: ID 0x{:x} is not a standard ID, ignored", definition.name, definition.id);
+        }
+    }
+}
+
+DbcDecoder::Signal DbcDecoder::compile(const DbcSignal& signal)
+{
+    Signal c{};
+    c.mask = signal.length >= 64 ? ~uint64_t{0} : (uint64_t{1} << signal.length) - 1;
+    c.factor = signal.factor;
+    c.offset = signal.offset;
+    c.mux_value = signal.mux_value;
+    c.start_bit = signal.start_bit;
+    c.length = static_cast<uint8_t>(signal.length);
+    c.value_type = signal.value_type;
+    c.little_endian = signal.little_endian;
+    c.is_signed = signal.is_signed;
+    c.multiplexed = signal.mux == DbcSignal::Mux::Multiplexed;
+
+    // The load window starts at the signal's first byte but never reads past the frame buffer
+    size_t first_bit;
+    size_t last_bit;
+    if (signal.little_endian) {
+        first_bit = signal.start_bit;
+        last_bit = signal.start_bit + signal.length - 1;
+    } else {
+        first_bit = motorola_msb(signal.start_bit);
+        last_bit = first_bit + signal.length - 1;
+    }
+    const size_t window = std::min(first_bit / 8, last_window);
+    const size_t last_byte = last_bit / 8;
+
+    // Signals reaching past 64 bytes can never be present
+    c.min_len = static_cast<uint8_t>(std::min<size_t>(last_byte + 1, CanFrame::max_data_len + 1));
+    c.byte = static_cast<uint8_t>(window);
+    if (signal.little_endian) {
+        const size_t shift = first_bit - window * 8;
+        c.wide = shift + signal.length > 64;
+        c.shift = static_cast<uint8_t>(c.wide ? 0 : shift);
+    } else {
+        const size_t end = last_bit - window * 8;   // LSB position inside the window
+        c.wide = end > 63;
+        c.shift = static_cast<uint8_t>(c.wide ? 0 : 63 - end);
+    }
+    return c;
+}
+
+uint64_t DbcDecoder::extract(const Signal& signal, const CanFrame& frame)
+{
+    const uint8_t* data = frame.data.data();
+    if (!signal.wide) {
+        const uint64_t window = signal.little_endian ? load_le(data + signal.byte) : load_be(data + signal.byte);
+        return (window >> signal.shift) & signal.mask;
+    }
+
+    // Unaligned signals longer than 57 bits
+    uint64_t raw = 0;
+    if (signal.little_endian) {
+        for (size_t i = 0; i < signal.length; ++i) {
+            const size_t bit = signal.start_bit + i;
+            raw |= static_cast<uint64_t>((data[bit / 8] >> (bit % 8)) & 1) << i;
+        }
+    } else {
+        const size_t msb = motorola_msb(signal.start_bit);
+        for (size_t bit = msb; bit < msb + signal.length; ++bit) {
+            raw = (raw << 1) | ((data[bit / 8] >> (7 - bit % 8)) & 1);
+        }
+    }
+    return raw;
+}
+
+double DbcDecoder::physical(const Signal& signal, uint64_t raw)
+{
+    switch (signal.value_type) {
+    case DbcSignal::ValueType::Float32:
+        return static_cast<double>(std::bit_cast<float>(static_cast<uint32_t>(raw))) * signal.factor + signal.offset;
+    case DbcSignal::ValueType::Float64:
+        return std::bit_cast<double>(raw) * signal.factor + signal.offset;
+    case DbcSignal::ValueType::Integer:
+        break;
+    }
+
+    if (signal.is_signed) {
+        if (signal.length < 64 && ((raw >> (signal.length - 1)) & 1)) {
+            raw |= ~signal.mask;
+        }
+        return static_cast<double>(static_cast<int64_t>(raw)) * signal.factor + signal.offset;
+    }
+    return static_cast<double>(raw) * signal.factor + signal.offset;
+}
+
+size_t DbcDecoder::decode(const Message& message, const CanFrame& frame, Value* out) const
+{
+    const Signal* signals = signals_.data() + message.first;
+
+    // The multiplexor picks which multiplexed signals the frame carries
+    bool has_mux = false;
+    uint64_t mux = 0;
+    if (message.multiplexor >= 0) {
+        const Signal& selector = signals[message.multiplexor];
+        if (frame.len >= selector.min_len) {
+            mux = extract(selector, frame);
+            has_mux = true;
+        }
+    }
+
+    size_t count = 0;
+    for (uint16_t i = 0; i < message.count; ++i) {
+        const Signal& signal = signals[i];
+        if (frame.len < signal.min_len) {
+            continue;
+        }
+        if (signal.multiplexed && (!has_mux || mux != signal.mux_value)) {
+            continue;
+        }
+        out[count++] = Value{i, physical(signal, extract(signal, frame))};
+    }
+    return count;
+}
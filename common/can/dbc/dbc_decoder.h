@@ -0,0 +1,109 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "can/can_frame.h"
+#include "can/dbc/dbc_database.h"
+
+
+// DBC messages compiled into flat tables for the receive path. Every signal becomes a fixed
+// 64-bit window load, shift and mask with the scaling folded in; lookups are an array index
+// for standard IDs and one hash probe for extended IDs. Decoding never allocates.
+class DbcDecoder
+{
+public:
+    struct Value {
+        uint16_t signal;    // index into DbcMessage::signals
+        double value;       // physical value: raw * factor + offset
+    };
+
+    struct Message {
+        uint32_t first;         // first signal in signals_
+        uint16_t count;
+        int32_t multiplexor;    // position of the multiplexor among the message's signals, -1 if none
+        uint32_t index;         // into DbcDatabase::messages
+    };
+
+    explicit DbcDecoder(DbcDatabase database);
+
+    const Message* find(const CanFrame& frame) const
+    {
+        int32_t index = -1;
+        if (frame.is_extended) {
+            auto it = extended_.find(frame.id);
+            if (it != extended_.end()) {
+                index = it->second;
+            }
+        } else if (frame.id < standard_.size()) {
+            index = standard_[frame.id];
+        }
+        return index < 0 ? nullptr : &messages_[static_cast<size_t>(index)];
+    }
+
+    // Writes the signals present in `frame` to `out`, which must hold message.count values.
+    // Signals beyond the frame length and multiplexed signals of another multiplexor value
+    // are left out. Returns the number of values written.
+    size_t decode(const Message& message, const CanFrame& frame, Value* out) const;
+
+    const DbcDatabase& database() const { return database_; }
+    const DbcMessage& definition(const Message& message) const { return database_.messages[message.index]; }
+
+    // Largest signal count of any message, enough room for decode()
+    size_t max_signals() const { return max_signals_; }
+
+private:
+    struct Signal {
+        uint64_t mask;
+        double factor;
+        double offset;
+        uint32_t mux_value;
+        uint16_t start_bit;     // DBC start bit, for the bit-by-bit path only
+        uint8_t length;
+        uint8_t byte;           // start of the 8-byte load window
+        uint8_t shift;          // right shift of the loaded window
+        uint8_t min_len;        // frame bytes needed to hold the signal
+        DbcSignal::ValueType value_type;
+        bool little_endian;
+        bool is_signed;
+        bool multiplexed;
+        bool wide;              // spans more than 8 bytes, extracted bit by bit
+    };
+
+    static Signal compile(const DbcSignal& signal);
+    static uint64_t extract(const Signal& signal, const CanFrame& frame);
+    static double physical(const Signal& signal, uint64_t raw);
+
+private:
+    DbcDatabase database_;
+    std::vector<Signal> signals_;
+    std::vector<Message> messages_;
+    std::vector<int32_t> standard_;                 // by 11-bit ID, -1 = not in the database
+    std::unordered_map<uint32_t, int32_t> extended_;
+    size_t max_signals_{0};
+};
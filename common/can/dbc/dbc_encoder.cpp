@@ -0,0 +1,141 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+#include "can/dbc/dbc_encoder.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+
+DbcEncoder::DbcEncoder(const DbcMessage& message)
+    : message_(message)
+{
+    for (size_t s = 0; s < message_.signals.size(); ++s) {
+        const auto& signal = message_.signals[s];
+        if (signal.mux == DbcSignal::Mux::Multiplexor) {
+            multiplexor_ = static_cast<int32_t>(s);
+        }
+        signals_.push_back(compile(signal));
+    }
+}
+
+DbcEncoder::Signal DbcEncoder::compile(const DbcSignal& signal)
+{
+    Signal c{};
+    c.mask = signal.length >= 64 ? ~uint64_t{0} : (uint64_t{1} << signal.length) - 1;
+    c.inverse_factor = signal.factor != 0.0 ? 1.0 / signal.factor : 1.0;
+    c.offset = signal.offset;
+    c.minimum = signal.minimum;
+    c.maximum = signal.maximum;
+    c.mux_value = signal.mux_value;
+    c.start_bit = signal.start_bit;
+    c.msb = static_cast<uint16_t>((signal.start_bit / 8) * 8 + (7 - signal.start_bit % 8));
+    c.length = static_cast<uint8_t>(signal.length);
+    c.value_type = signal.value_type;
+    c.little_endian = signal.little_endian;
+    c.is_signed = signal.is_signed;
+    c.multiplexed = signal.mux == DbcSignal::Mux::Multiplexed;
+    if (signal.is_signed) {
+        c.raw_min = -std::ldexp(1.0, signal.length - 1);
+        c.raw_max = std::ldexp(1.0, signal.length - 1) - 1.0;
+    } else {
+        c.raw_min = 0.0;
+        c.raw_max = std::ldexp(1.0, signal.length) - 1.0;
+    }
+    return c;
+}
+
+uint64_t DbcEncoder::to_raw(size_t index, double value) const
+{
+    const Signal& signal = signals_[index];
+    if (signal.maximum > signal.minimum) {
+        value = std::clamp(value, signal.minimum, signal.maximum);
+    }
+    const double scaled = (value - signal.offset) * signal.inverse_factor;
+
+    switch (signal.value_type) {
+    case DbcSignal::ValueType::Float32:
+        return std::bit_cast<uint32_t>(static_cast<float>(scaled));
+    case DbcSignal::ValueType::Float64:
+        return std::bit_cast<uint64_t>(scaled);
+    case DbcSignal::ValueType::Integer:
+        break;
+    }
+
+    if (std::isnan(scaled)) {
+        return 0;
+    }
+    // Clamping in double keeps the conversion defined; 64-bit limits round to 2^63 / 2^64,
+    // so those are checked before converting
+    const double raw = std::clamp(std::nearbyint(scaled), signal.raw_min, signal.raw_max);
+    if (signal.is_signed) {
+        const int64_t v = raw >= 0x1p63 ? INT64_MAX : static_cast<int64_t>(raw);
+        return static_cast<uint64_t>(v) & signal.mask;
+    }
+    return raw >= 0x1p64 ? UINT64_MAX : static_cast<uint64_t>(raw);
+}
+
+void DbcEncoder::insert(size_t index, uint64_t raw, uint8_t* data) const
+{
+    // Frames are built on the send schedule, not per received frame, so bit by bit is fine here
+    const Signal& signal = signals_[index];
+    raw &= signal.mask;
+    if (signal.little_endian) {
+        for (size_t i = 0; i < signal.length; ++i) {
+            const size_t bit = signal.start_bit + i;
+            const auto mask = static_cast<uint8_t>(1u << (bit % 8));
+            data[bit / 8] = ((raw >> i) & 1) ? (data[bit / 8] | mask) : (data[bit / 8] & ~mask);
+        }
+    } else {
+        for (size_t i = 0; i < signal.length; ++i) {
+            const size_t bit = signal.msb + i;
+            const auto mask = static_cast<uint8_t>(0x80u >> (bit % 8));
+            data[bit / 8] = ((raw >> (signal.length - 1 - i)) & 1) ? (data[bit / 8] | mask) : (data[bit / 8] & ~mask);
+        }
+    }
+}
+
+void DbcEncoder::encode(std::span<const double> values, uint32_t mux, CanFrame& frame) const
+{
+    frame.id = message_.id;
+    frame.is_extended = message_.is_extended;
+    frame.is_rtr = false;
+    frame.is_fd = message_.size > 8;
+    frame.len = can_fd_round_up_len(message_.size);
+    frame.data.fill(0);
+
+    const size_t count = std::min(values.size(), signals_.size());
+    for (size_t i = 0; i < count; ++i) {
+        const Signal& signal = signals_[i];
+        // Signals that do not fit the message size are left out, as the decoder would skip them
+        const size_t last_bit = signal.little_endian ? signal.start_bit + signal.length - 1u : signal.msb + signal.length - 1u;
+        if (last_bit / 8 >= message_.size) {
+            continue;
+        }
+        if (static_cast<int32_t>(i) == multiplexor_) {
+            insert(i, mux, frame.data.data());
+        } else if (!signal.multiplexed || (multiplexor_ >= 0 && signal.mux_value == mux)) {
+            insert(i, to_raw(i, values[i]), frame.data.data());
+        }
+    }
+}
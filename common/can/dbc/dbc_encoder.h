@@ -0,0 +1,84 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "can/can_frame.h"
+#include "can/dbc/dbc_database.h"
+
+
+// Packs physical values into frames of one DBC message. Integer signals are converted to their
+// fixed-point raw value, round((value - offset) / factor), clamped to the signal's [minimum,
+// maximum] (when the DBC gives a range) and to what its bits can hold. SIG_VALTYPE_ floats are
+// stored as IEEE bits after the same scaling.
+class DbcEncoder
+{
+public:
+    explicit DbcEncoder(const DbcMessage& message);
+
+    // Fills `frame` from `values` (one physical value per signal of the message): ID and flags
+    // from the message, length = message size (rounded up to a valid FD length beyond 8 bytes).
+    // With a multiplexor, it is set to `mux` and only the multiplexed signals of that value are
+    // written; `mux` is ignored otherwise.
+    void encode(std::span<const double> values, uint32_t mux, CanFrame& frame) const;
+
+    // Raw bits of `value` for signal `index`, as they appear in the payload
+    uint64_t to_raw(size_t index, double value) const;
+
+    // Writes the low `length` bits of `raw` to signal `index` in `data`, other bits are kept
+    void insert(size_t index, uint64_t raw, uint8_t* data) const;
+
+    const DbcMessage& message() const { return message_; }
+
+    // Position of the multiplexor among the signals, -1 if the message has none
+    int32_t multiplexor() const { return multiplexor_; }
+
+private:
+    struct Signal {
+        uint64_t mask;
+        double inverse_factor;
+        double offset;
+        double minimum;         // physical range, equal when the DBC gives none
+        double maximum;
+        double raw_min;         // raw range the bits can hold
+        double raw_max;
+        uint32_t mux_value;
+        uint16_t msb;           // bit position of the MSB, 0 = MSB of byte 0 (big endian only)
+        uint16_t start_bit;
+        uint8_t length;
+        DbcSignal::ValueType value_type;
+        bool little_endian;
+        bool is_signed;
+        bool multiplexed;
+    };
+
+    static Signal compile(const DbcSignal& signal);
+
+private:
+    DbcMessage message_;
+    std::vector<Signal> signals_;
+    int32_t multiplexor_{-1};
+};
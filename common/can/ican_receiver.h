@@ -23,16 +23,36 @@
 
 #pragma once
 
+#include <chrono>
+#include <cstddef>
 #include <functional>
 #include <memory>
+#include <span>
 #include <string>
 
 #include "can/can_frame.h"
 
+
+struct CanReceiveOptions {
+    size_t batch_size{1};                       // max frames drained per wakeup
+    std::chrono::microseconds max_wait{0};      // how long to wait for a batch to fill up
+    bool kernel_timestamps{false};              // fill CanFrame::timestamp_ns with the kernel receive time
+};
+
+// Frame passes when (frame id & mask) == (id & mask), inverted filters pass the complement.
+// Standard filters only match standard frames, extended filters only extended ones.
+struct CanFilter {
+    uint32_t id{0};
+    uint32_t mask{0};
+    bool is_extended{false};
+    bool is_inverted{false};
+};
+
 class ICanReceiver
 {
 public:
     using Callback = std::function<void(const CanFrame&)>;
+    using BatchCallback = std::function<void(std::span<const CanFrame>)>;
 
     class Subscription
     {
@@ -51,6 +71,10 @@ public:
     virtual void stop() = 0;
 
     virtual SubscriptionPtr subscribe(Callback cb) = 0;
+    virtual SubscriptionPtr subscribe_batch(BatchCallback cb) = 0;
+
+    // Replaces the acceptance filters, also while running. An empty list accepts every frame.
+    virtual bool set_filters(std::span<const CanFilter> filters) = 0;
 
     virtual bool is_open() const = 0;
 
@@ -23,8 +23,10 @@
 
 #pragma once
 
-#include <vector>
+#include <cstddef>
+#include <span>
 #include <string>
+#include <vector>
 
 #include "can/can_frame.h"
 
@@ -39,6 +41,10 @@ public:
 
     virtual bool send(const CanFrame& frame) = 0;
 
+    // Sends frames in order and returns how many were written. Frames
+    // [0, result) went out, frames [result, size) were not sent.
+    virtual size_t send_batch(std::span<const CanFrame> frames) = 0;
+
     virtual bool is_open() const = 0;
 
     virtual std::string name() const = 0;
@@ -0,0 +1,282 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+
+#include "can/linux/io_uring/can_receiver.h"
+#include "can/linux/sockets/can_frame_conversion.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#include "logging/logger.h"
+
+
+static LogModule log_module("can");
+
+namespace {
+    constexpr unsigned ring_entries = 64;
+    constexpr int buffer_group = 0;
+    constexpr unsigned socket_index = 0;                        // registered file slot of the socket
+    constexpr auto idle_timeout = std::chrono::milliseconds(100);  // bounds how late stop() is noticed
+
+    // Multishot recv delivers no control messages
+    CanReceiveOptions without_timestamps(const std::string& ifname, CanReceiveOptions options)
+    {
+        if (options.kernel_timestamps) {
+            LOG_INFO(log_module, "{}: kernel timestamps not available with the io_uring backend", ifname);
+            options.kernel_timestamps = false;
+        }
+        return options;
+    }
+
+    // Buffer rings hold a power of two entries, keep a few batches in flight
+    unsigned buffer_count(size_t batch_size)
+    {
+        unsigned count = 256;
+        while (count < batch_size * 4 && count < 32768) {
+            count *= 2;
+        }
+        return count;
+    }
+
+    struct __kernel_timespec to_timespec(std::chrono::nanoseconds ns)
+    {
+        struct __kernel_timespec ts{};
+        ts.tv_sec = ns.count() / 1000000000;
+        ts.tv_nsec = ns.count() % 1000000000;
+        return ts;
+    }
+}
+
+IoUringCanReceiver::IoUringCanReceiver(std::string ifname, CanReceiveOptions options)
+    : LinuxSocketCanReceiver(ifname, without_timestamps(ifname, std::move(options)))
+{
+}
+
+bool IoUringCanReceiver::open()
+{
+    if (ring_ready_)
+        return true;
+
+    if (!LinuxSocketCanReceiver::open())
+        return false;
+
+    if (!setup_ring()) {
+        teardown_ring();
+        LinuxSocketCanReceiver::close();
+        return false;
+    }
+    return true;
+}
+
+bool IoUringCanReceiver::setup_ring()
+{
+    int ret = io_uring_queue_init(ring_entries, &ring_, 0);
+    if (ret < 0) {
+        LOG_WARN(log_module, "{}: io_uring setup failed: {}", ifname_, std::strerror(-ret));
+        return false;
+    }
+    ring_ready_ = true;
+
+    // A registered socket spares the file lookup on every completion
+    ret = io_uring_register_files(&ring_, &socket_fd_, 1);
+    if (ret < 0) {
+        LOG_WARN(log_module, "{}: io_uring file registration failed: {}", ifname_, std::strerror(-ret));
+        return false;
+    }
+
+    buffers_.assign(buffer_count(options_.batch_size), {});
+    buf_ring_ = io_uring_setup_buf_ring(&ring_, buffers_.size(), buffer_group, 0, &ret);
+    if (!buf_ring_) {
+        LOG_WARN(log_module, "{}: io_uring buffer ring not supported: {}", ifname_, std::strerror(-ret));
+        return false;
+    }
+
+    const int mask = io_uring_buf_ring_mask(buffers_.size());
+    for (size_t i = 0; i < buffers_.size(); ++i) {
+        io_uring_buf_ring_add(buf_ring_, &buffers_[i], sizeof(struct canfd_frame), i, mask, i);
+    }
+    io_uring_buf_ring_advance(buf_ring_, buffers_.size());
+
+    if (!arm_recv())
+        return false;
+
+    // Without multishot support the request completes at once with EINVAL, a supported one
+    // sits on the socket until the first frame arrives
+    io_uring_submit(&ring_);
+    struct io_uring_cqe* cqe = nullptr;
+    if (io_uring_peek_cqe(&ring_, &cqe) == 0 && cqe->res == -EINVAL) {
+        LOG_WARN(log_module, "{}: io_uring multishot recv not supported", ifname_);
+        return false;
+    }
+
+    LOG_INFO(log_module, "{}: io_uring receive with {} buffers", ifname_, buffers_.size());
+    return true;
+}
+
+void IoUringCanReceiver::teardown_ring()
+{
+    if (!ring_ready_)
+        return;
+
+    // Exiting the ring cancels the armed recv
+    if (buf_ring_) {
+        io_uring_free_buf_ring(&ring_, buf_ring_, buffers_.size(), buffer_group);
+        buf_ring_ = nullptr;
+    }
+    io_uring_queue_exit(&ring_);
+    ring_ready_ = false;
+}
+
+bool IoUringCanReceiver::arm_recv()
+{
+    struct io_uring_sqe* sqe = io_uring_get_sqe(&ring_);
+    if (!sqe) {
+        LOG_ERROR(log_module, "{}: io_uring submission queue full", ifname_);
+        return false;
+    }
+
+    io_uring_prep_recv_multishot(sqe, socket_index, nullptr, 0, 0);
+    sqe->flags |= IOSQE_FIXED_FILE | IOSQE_BUFFER_SELECT;
+    sqe->buf_group = buffer_group;
+    return true;
+}
+
+bool IoUringCanReceiver::start()
+{
+    if (!ring_ready_)
+        return false;
+
+    running_.store(true);
+    ring_thread_ = std::thread(&IoUringCanReceiver::receive_loop, this);
+    return true;
+}
+
+void IoUringCanReceiver::stop()
+{
+    running_.store(false);
+}
+
+void IoUringCanReceiver::wait()
+{
+    if (ring_thread_.joinable())
+        ring_thread_.join();
+}
+
+void IoUringCanReceiver::close()
+{
+    running_.store(false);
+    if (ring_thread_.joinable())
+        ring_thread_.join();
+
+    teardown_ring();
+    LinuxSocketCanReceiver::close();
+}
+
+void IoUringCanReceiver::receive_loop()
+{
+    std::vector<CanFrame> batch(std::max<size_t>(options_.batch_size, 1));
+
+    while (running_.load()) {
+        // Submits a pending re-arm and sleeps until the first completion
+        struct io_uring_cqe* cqe = nullptr;
+        auto timeout = to_timespec(idle_timeout);
+        int ret = io_uring_submit_and_wait_timeout(&ring_, &cqe, 1, &timeout, nullptr);
+        if (ret < 0 && ret != -ETIME && ret != -EINTR) {
+            LOG_ERROR(log_module, "{}: io_uring wait error: {}", ifname_, std::strerror(-ret));
+            rx_errors_.add();
+            std::this_thread::sleep_for(idle_timeout);
+            continue;
+        }
+
+        // Same batching contract as the socket backend: wait up to max_wait for a full batch
+        if (options_.max_wait.count() > 0 && io_uring_cq_ready(&ring_) > 0
+            && io_uring_cq_ready(&ring_) < batch.size()) {
+            timeout = to_timespec(options_.max_wait);
+            io_uring_wait_cqes(&ring_, &cqe, batch.size(), &timeout, nullptr);
+        }
+
+        const size_t count = reap(batch);
+        if (count > 0) {
+            rx_frames_.add(count);
+            dispatch({batch.data(), count});
+        }
+    }
+}
+
+// Drains all completions, delivering full batches on the way. Returns the size of the
+// partial batch left at the front of `batch`.
+size_t IoUringCanReceiver::reap(std::vector<CanFrame>& batch)
+{
+    size_t count = 0;
+    const int mask = io_uring_buf_ring_mask(buffers_.size());
+    unsigned head = 0;
+    unsigned seen = 0;
+    int recycled = 0;
+    bool rearm = false;
+
+    struct io_uring_cqe* cqe = nullptr;
+    io_uring_for_each_cqe(&ring_, head, cqe) {
+        ++seen;
+        // The recv stops on errors and when the buffer ring ran dry
+        if (!(cqe->flags & IORING_CQE_F_MORE))
+            rearm = true;
+
+        if (cqe->res < 0) {
+            if (cqe->res == -ENOBUFS) {
+                LOG_DEBUG(log_module, "{}: io_uring receive buffers exhausted", ifname_);
+            } else {
+                LOG_ERROR(log_module, "{}: io_uring recv error: {}", ifname_, std::strerror(-cqe->res));
+            }
+            rx_errors_.add();
+            continue;
+        }
+        if (!(cqe->flags & IORING_CQE_F_BUFFER))
+            continue;
+
+        const unsigned bid = cqe->flags >> IORING_CQE_BUFFER_SHIFT;
+        if (from_linux_frame(buffers_[bid], static_cast<size_t>(cqe->res), batch[count])) {
+            ++count;
+        } else {
+            rx_errors_.add();
+        }
+
+        // The frame is copied out, the buffer goes straight back to the kernel
+        io_uring_buf_ring_add(buf_ring_, &buffers_[bid], sizeof(struct canfd_frame), bid, mask, recycled++);
+
+        if (count == batch.size()) {
+            rx_frames_.add(count);
+            dispatch({batch.data(), count});
+            count = 0;
+        }
+    }
+
+    io_uring_cq_advance(&ring_, seen);
+    io_uring_buf_ring_advance(buf_ring_, recycled);
+
+    // Queued here, submitted by the next wait
+    if (rearm && running_.load())
+        arm_recv();
+
+    return count;
+}
@@ -0,0 +1,69 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+
+#pragma once
+
+#include <thread>
+#include <vector>
+
+#include <liburing.h>
+#include <linux/can.h>
+
+#include "can/linux/sockets/can_receiver.h"
+
+
+// SocketCAN receiver fed by io_uring: one multishot recv stays armed on the socket and the
+// kernel picks a buffer from a provided buffer ring for every frame, so steady-state receive
+// costs one io_uring_enter() per batch of completions instead of a syscall per frame.
+// open() fails on kernels without buffer rings or multishot recv (before 6.0), callers fall
+// back to LinuxSocketCanReceiver.
+class IoUringCanReceiver : public LinuxSocketCanReceiver
+{
+public:
+    explicit IoUringCanReceiver(std::string ifname, CanReceiveOptions options = {});
+
+    ~IoUringCanReceiver() override
+    {
+        close();
+    }
+
+    bool open() override;
+    bool start() override;
+    void stop() override;
+    void close() override;
+    void wait() override;
+
+private:
+    bool setup_ring();
+    void teardown_ring();
+    bool arm_recv();
+    void receive_loop();
+    size_t reap(std::vector<CanFrame>& batch);
+
+private:
+    struct io_uring ring_{};
+    bool ring_ready_{false};
+    struct io_uring_buf_ring* buf_ring_{nullptr};
+    std::vector<struct canfd_frame> buffers_;   // indexed by buffer id
+    std::thread ring_thread_;
+};
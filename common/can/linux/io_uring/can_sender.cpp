@@ -0,0 +1,174 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+
+#include "can/linux/io_uring/can_sender.h"
+#include "can/linux/sockets/can_frame_conversion.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#include "logging/logger.h"
+
+static LogModule log_module("can");
+
+namespace {
+    constexpr unsigned ring_entries = 256;      // largest batch submitted at once
+    constexpr unsigned socket_index = 0;        // registered file slot of the socket
+}
+
+bool IoUringCanSender::open() {
+    if (!LinuxSocketCanSender::open()) {
+        return false;
+    }
+
+    if (!setup_ring()) {
+        LinuxSocketCanSender::close();
+        return false;
+    }
+
+    tx_raw_.resize(ring_entries);
+    LOG_INFO(log_module, "{}: io_uring send enabled", ifname_);
+    return true;
+}
+
+void IoUringCanSender::close() {
+    std::lock_guard<std::mutex> lock(send_mutex_);
+    teardown_ring();
+    LinuxSocketCanSender::close();
+}
+
+bool IoUringCanSender::setup_ring() {
+    int ret = io_uring_queue_init(ring_entries, &ring_, 0);
+    if (ret < 0) {
+        LOG_WARN(log_module, "{}: io_uring setup failed: {}", ifname_, std::strerror(-ret));
+        return false;
+    }
+    ring_ready_ = true;
+
+    ret = io_uring_register_files(&ring_, &sock_, 1);
+    if (ret < 0) {
+        LOG_WARN(log_module, "{}: io_uring file registration failed: {}", ifname_, std::strerror(-ret));
+        teardown_ring();
+        return false;
+    }
+    return true;
+}
+
+void IoUringCanSender::teardown_ring() {
+    if (ring_ready_) {
+        io_uring_queue_exit(&ring_);
+        ring_ready_ = false;
+    }
+}
+
+size_t IoUringCanSender::send_batch_locked(std::span<const CanFrame> frames) {
+    // The ring was given up after an error, sendmmsg() with its own buffers takes over
+    if (!ring_ready_) {
+        return LinuxSocketCanSender::send_batch_locked(frames);
+    }
+
+    size_t sent = 0;
+    while (sent < frames.size()) {
+        auto chunk = frames.subspan(sent, std::min<size_t>(frames.size() - sent, ring_entries));
+
+        // FD frames on a socket without FD support end the batch, like a failed send()
+        const size_t usable = sendable(chunk);
+        if (usable < chunk.size()) {
+            chunk = chunk.first(usable);
+            if (chunk.empty()) {
+                return sent;
+            }
+        }
+
+        for (size_t i = 0; i < chunk.size(); ++i) {
+            const size_t len = to_linux_frame(chunk[i], tx_raw_[i]);
+            struct io_uring_sqe* sqe = io_uring_get_sqe(&ring_);
+            io_uring_prep_send(sqe, socket_index, &tx_raw_[i], len, 0);
+            sqe->flags |= IOSQE_FIXED_FILE;
+            if (i + 1 < chunk.size()) {
+                sqe->flags |= IOSQE_IO_LINK;
+            }
+            io_uring_sqe_set_data64(sqe, i);
+        }
+
+        // Everything queued must reach the kernel now, SQEs left in the SQ would go out with the next batch
+        size_t submitted = 0;
+        bool submit_failed = false;
+        while (submitted < chunk.size()) {
+            int ret = io_uring_submit(&ring_);
+            if (ret == -EINTR) {
+                continue;
+            }
+            if (ret <= 0) {
+                LOG_ERROR(log_module, "{}: io_uring submit failed: {}", ifname_, std::strerror(ret < 0 ? -ret : EAGAIN));
+                submit_failed = true;
+                break;
+            }
+            submitted += static_cast<size_t>(ret);
+        }
+
+        // Every submitted send completes, cancelled ones with ECANCELED, and all are reaped before
+        // returning: the kernel may read tx_raw_ until then and the next batch must not see them.
+        // The first failure marks how far the batch got.
+        size_t done = submitted;
+        size_t reaped = 0;
+        while (reaped < submitted) {
+            struct io_uring_cqe* cqe = nullptr;
+            int ret = io_uring_wait_cqe(&ring_, &cqe);
+            if (ret == -EINTR) {
+                continue;
+            }
+            if (ret < 0) {
+                LOG_ERROR(log_module, "{}: io_uring wait failed: {}", ifname_, std::strerror(-ret));
+                break;
+            }
+            if (cqe->res < 0) {
+                done = std::min<size_t>(done, io_uring_cqe_get_data64(cqe));
+            }
+            io_uring_cqe_seen(&ring_, cqe);
+            ++reaped;
+        }
+
+        if (reaped < submitted) {
+            // Completions can no longer be matched to batches, later batches use sendmmsg()
+            LOG_WARN(log_module, "{}: giving up io_uring send", ifname_);
+            teardown_ring();
+            return sent;
+        }
+        if (submit_failed) {
+            // Drops the unsubmitted SQEs, nothing is in flight any more
+            teardown_ring();
+            if (!setup_ring()) {
+                LOG_WARN(log_module, "{}: giving up io_uring send", ifname_);
+            }
+        }
+
+        sent += done;
+        if (done < chunk.size()) {
+            return sent;
+        }
+    }
+
+    return sent;
+}
@@ -0,0 +1,61 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+
+#pragma once
+
+#include <vector>
+
+#include <liburing.h>
+#include <linux/can.h>
+
+#include "can/linux/sockets/can_sender.h"
+
+
+// SocketCAN sender that writes batches through io_uring: one linked send per frame and a
+// single io_uring_enter() per batch. The link keeps the frames in order and cancels the
+// rest of the batch after the first failed send. Single frames still go through write().
+class IoUringCanSender : public LinuxSocketCanSender {
+public:
+    explicit IoUringCanSender(std::string ifname)
+        : LinuxSocketCanSender(std::move(ifname)) {}
+
+    ~IoUringCanSender() override {
+        close();
+    }
+
+    // Fails when the kernel has no io_uring, callers fall back to LinuxSocketCanSender
+    bool open() override;
+
+    void close() override;
+
+protected:
+    size_t send_batch_locked(std::span<const CanFrame> frames) override;
+
+private:
+    bool setup_ring();
+    void teardown_ring();
+
+    struct io_uring ring_{};
+    bool ring_ready_{false};
+    std::vector<struct canfd_frame> tx_raw_;    // send buffers, guarded by send_mutex_
+};
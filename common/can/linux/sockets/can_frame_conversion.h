@@ -0,0 +1,112 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+
+#include <sys/socket.h>
+#include <linux/can.h>
+#include <linux/errqueue.h>
+
+#include "can/can_frame.h"
+
+
+// Conversions between CanFrame and the SocketCAN wire structs. A canfd_frame
+// buffer holds both kinds, classic frames share its layout and use CAN_MTU.
+
+// Fills `f` from a frame read from a socket, `nbytes` is CAN_MTU or CANFD_MTU.
+// Returns false for short or unknown reads.
+inline bool from_linux_frame(const struct canfd_frame& frame, size_t nbytes, CanFrame& f)
+{
+    if (nbytes != CAN_MTU && nbytes != CANFD_MTU)
+        return false;
+
+    f = CanFrame{};
+    f.id = frame.can_id & CAN_EFF_MASK;
+    f.is_extended = frame.can_id & CAN_EFF_FLAG;
+
+    if (nbytes == CANFD_MTU) {
+        f.is_fd = true;
+        f.is_brs = frame.flags & CANFD_BRS;
+        f.is_esi = frame.flags & CANFD_ESI;
+        f.len = std::min<uint8_t>(frame.len, CANFD_MAX_DLEN);
+    } else {
+        f.is_rtr = frame.can_id & CAN_RTR_FLAG;
+        f.len = std::min<uint8_t>(frame.len, CAN_MAX_DLEN);
+    }
+
+    std::memcpy(f.data.data(), frame.data, f.len);
+    return true;
+}
+
+// Fills `cf` for writing and returns the number of bytes to write (CAN_MTU or CANFD_MTU).
+// FD payloads are zero padded up to the next valid FD length.
+inline size_t to_linux_frame(const CanFrame& f, struct canfd_frame& cf)
+{
+    cf = {};
+    cf.can_id = f.id | (f.is_extended ? CAN_EFF_FLAG : 0);
+
+    if (f.is_fd) {
+        cf.flags = (f.is_brs ? CANFD_BRS : 0) | (f.is_esi ? CANFD_ESI : 0);
+        uint8_t len = std::min<uint8_t>(f.len, CANFD_MAX_DLEN);
+        std::memcpy(cf.data, f.data.data(), len);
+        cf.len = can_fd_round_up_len(len);
+        return CANFD_MTU;
+    }
+
+    cf.can_id |= (f.is_rtr ? CAN_RTR_FLAG : 0);
+    cf.len = std::min<uint8_t>(f.len, CAN_MAX_DLEN);
+    std::memcpy(cf.data, f.data.data(), cf.len);
+    return CAN_MTU;
+}
+
+// Receive time from the control messages of a recvmsg()/recvmmsg() result, in ns since Unix
+// epoch, from the software stamp of SO_TIMESTAMPING or from SO_TIMESTAMPNS. Returns 0 when
+// the socket delivered none.
+inline uint64_t receive_timestamp_ns(const struct msghdr& msg)
+{
+    auto to_ns = [](const struct timespec& ts) {
+        return static_cast<uint64_t>(ts.tv_sec) * 1000000000ull + static_cast<uint64_t>(ts.tv_nsec);
+    };
+
+    for (struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg; cmsg = CMSG_NXTHDR(const_cast<struct msghdr*>(&msg), cmsg)) {
+        if (cmsg->cmsg_level != SOL_SOCKET)
+            continue;
+
+        if (cmsg->cmsg_type == SCM_TIMESTAMPING) {
+            struct scm_timestamping stamps;
+            std::memcpy(&stamps, CMSG_DATA(cmsg), sizeof(stamps));
+            if (stamps.ts[0].tv_sec || stamps.ts[0].tv_nsec)
+                return to_ns(stamps.ts[0]);
+            continue;
+        }
+        if (cmsg->cmsg_type == SCM_TIMESTAMPNS) {
+            struct timespec ts;
+            std::memcpy(&ts, CMSG_DATA(cmsg), sizeof(ts));
+            return to_ns(ts);
+        }
+    }
+    return 0;
+}
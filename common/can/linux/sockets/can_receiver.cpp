@@ -22,22 +22,26 @@
  */
 
 #include "can/linux/sockets/can_receiver.h"
+#include "can/linux/sockets/can_frame_conversion.h"
 
 #include <cstring>
 #include <algorithm>
-#include <iostream>
 #include <unistd.h>
 #include <cerrno>
 #include <poll.h>
 
 #include <linux/can.h>
 #include <linux/can/raw.h>
+#include <linux/net_tstamp.h>
 #include <net/if.h>
 #include <sys/ioctl.h>
 #include <sys/socket.h>
 
+#include "logging/logger.h"
 
 
+static LogModule log_module("can");
+
 bool LinuxSocketCanReceiver::open()
 {
     if (is_open())
@@ -57,6 +61,30 @@ bool LinuxSocketCanReceiver::open()
         return false;
     }
 
+    // Receive classic and FD frames on the same socket, kernels without FD support keep classic only
+    int enable_fd = 1;
+    if (setsockopt(socket_fd_, SOL_CAN_RAW, CAN_RAW_FD_FRAMES, &enable_fd, sizeof(enable_fd)) < 0)
+    {
+        LOG_WARN(log_module, "{}: CAN-FD frames not supported: {}", ifname_, std::strerror(errno));
+    }
+
+    if (options_.kernel_timestamps)
+        enable_timestamps();
+
+    // Filters set before open() take effect before the first frame is queued
+    bool filtered = false;
+    {
+        std::lock_guard lock(mutex_);
+        filtered = apply_filters();
+    }
+
+    if (!filtered)
+    {
+        ::close(socket_fd_);
+        socket_fd_ = -1;
+        return false;
+    }
+
     sockaddr_can addr {};
     addr.can_family  = AF_CAN;
     addr.can_ifindex = ifr.ifr_ifindex;
@@ -71,6 +99,57 @@ bool LinuxSocketCanReceiver::open()
     return true;
 }
 
+bool LinuxSocketCanReceiver::set_filters(std::span<const CanFilter> filters)
+{
+    std::lock_guard lock(mutex_);
+    filters_.assign(filters.begin(), filters.end());
+
+    // Not open yet: open() applies them
+    if (socket_fd_ < 0)
+        return true;
+
+    return apply_filters();
+}
+
+void LinuxSocketCanReceiver::enable_timestamps()
+{
+    // Software stamps only: they are CLOCK_REALTIME and comparable with system_clock, while a
+    // raw hardware stamp counts on the controller's own free-running clock
+    int flags = SOF_TIMESTAMPING_RX_SOFTWARE | SOF_TIMESTAMPING_SOFTWARE;
+    if (setsockopt(socket_fd_, SOL_SOCKET, SO_TIMESTAMPING, &flags, sizeof(flags)) == 0)
+        return;
+
+    int enable = 1;
+    if (setsockopt(socket_fd_, SOL_SOCKET, SO_TIMESTAMPNS, &enable, sizeof(enable)) < 0)
+        LOG_WARN(log_module, "{}: kernel receive timestamps not supported: {}", ifname_, std::strerror(errno));
+}
+
+bool LinuxSocketCanReceiver::apply_filters()
+{
+    std::vector<struct can_filter> raw;
+    raw.reserve(filters_.size());
+
+    for (const auto& f : filters_)
+    {
+        struct can_filter cf {};
+        cf.can_id = f.id | (f.is_extended ? CAN_EFF_FLAG : 0) | (f.is_inverted ? CAN_INV_FILTER : 0);
+        // Including CAN_EFF_FLAG in the mask keeps standard and extended IDs apart
+        cf.can_mask = (f.mask & (f.is_extended ? CAN_EFF_MASK : CAN_SFF_MASK)) | CAN_EFF_FLAG;
+        raw.push_back(cf);
+    }
+
+    // The kernel treats an empty filter list as "drop everything", accept all instead
+    if (raw.empty())
+        raw.push_back(can_filter{0, 0});
+
+    if (setsockopt(socket_fd_, SOL_CAN_RAW, CAN_RAW_FILTER, raw.data(), raw.size() * sizeof(struct can_filter)) < 0)
+    {
+        LOG_ERROR(log_module, "{}: setting CAN_RAW_FILTER failed: {}", ifname_, std::strerror(errno));
+        return false;
+    }
+    return true;
+}
+
 bool LinuxSocketCanReceiver::start()
 {
     running_.store(true);
@@ -113,8 +192,29 @@ ICanReceiver::SubscriptionPtr LinuxSocketCanReceiver::subscribe(Callback cb)
 {
     std::lock_guard lock(mutex_);
     auto id = ++next_id_;
-    subscribers_.emplace_back(id, std::move(cb));
 
+    // Publish a new version, the receive thread keeps using its snapshot until the next batch
+    auto next = std::make_shared<Subscribers>(*subscribers_.load());
+    next->frame.emplace_back(id, std::move(cb));
+    subscribers_.store(std::move(next), std::memory_order_release);
+
+    return make_subscription(id);
+}
+
+ICanReceiver::SubscriptionPtr LinuxSocketCanReceiver::subscribe_batch(BatchCallback cb)
+{
+    std::lock_guard lock(mutex_);
+    auto id = ++next_id_;
+
+    auto next = std::make_shared<Subscribers>(*subscribers_.load());
+    next->batch.emplace_back(id, std::move(cb));
+    subscribers_.store(std::move(next), std::memory_order_release);
+
+    return make_subscription(id);
+}
+
+ICanReceiver::SubscriptionPtr LinuxSocketCanReceiver::make_subscription(uint64_t id)
+{
     struct SubImpl : Subscription
     {
         SubImpl(LinuxSocketCanReceiver* p, uint64_t id)
@@ -136,13 +236,19 @@ ICanReceiver::SubscriptionPtr LinuxSocketCanReceiver::subscribe(Callback cb)
 void LinuxSocketCanReceiver::unsubscribe(uint64_t id)
 {
     std::lock_guard lock(mutex_);
-    subscribers_.erase(
-        std::remove_if(subscribers_.begin(), subscribers_.end(), [id](auto& s) { return s.first == id; }), subscribers_.end());
+    auto same_id = [id](auto& s) { return s.first == id; };
+
+    // A callback may still run on the receive thread from an older snapshot right after this returns
+    auto next = std::make_shared<Subscribers>(*subscribers_.load());
+    std::erase_if(next->frame, same_id);
+    std::erase_if(next->batch, same_id);
+    subscribers_.store(std::move(next), std::memory_order_release);
 }
 
 void LinuxSocketCanReceiver::receive_loop()
 {
     struct pollfd pfd{};
+    prepare_buffers();
 
     while (running_.load())
     {
@@ -159,7 +265,7 @@ void LinuxSocketCanReceiver::receive_loop()
         if (ret < 0) {
             if (errno == EINTR)
                 continue;
-            std::cerr << "poll() error: " << std::strerror(errno) << std::endl;
+            LOG_ERROR(log_module, "{}: poll() error: {}", ifname_, std::strerror(errno));
             break;
         }
 
@@ -167,42 +273,129 @@ void LinuxSocketCanReceiver::receive_loop()
             continue; // timeout, loop again
 
         if (pfd.revents & (POLLERR | POLLNVAL)) {
-            std::cerr << "poll() returned error on socket" << std::endl;
+            LOG_ERROR(log_module, "{}: poll() returned error on socket", ifname_);
             break;
         }
 
         if (pfd.revents & (POLLIN | POLLPRI)) {
-            struct can_frame frame {};
-            ssize_t n = ::read(socket_fd_, &frame, sizeof(frame));
-            if (n <= 0)
-                continue;
+            receive_batch();
+        }
+    }
+    LOG_DEBUG(log_module, "{}: worker thread exiting", ifname_);
+}
+
+void LinuxSocketCanReceiver::prepare_buffers()
+{
+    // Batch storage is allocated once, frames are plain data and reused between wakeups
+    const size_t batch_size = std::max<size_t>(options_.batch_size, 1);
+    rx_batch_.assign(batch_size, {});
+    rx_raw_.assign(batch_size, {});
+    rx_iov_.assign(batch_size, {});
+    rx_msgs_.assign(batch_size, {});
+    rx_control_.assign(options_.kernel_timestamps ? batch_size : 0, {});
+
+    for (size_t i = 0; i < batch_size; ++i) {
+        rx_iov_[i].iov_base = &rx_raw_[i];
+        rx_iov_[i].iov_len = sizeof(struct canfd_frame);
+        rx_msgs_[i].msg_hdr.msg_iov = &rx_iov_[i];
+        rx_msgs_[i].msg_hdr.msg_iovlen = 1;
+    }
+}
 
-            CanFrame f;
-            f.id = frame.can_id & CAN_EFF_MASK;
-            f.is_extended = frame.can_id & CAN_EFF_FLAG;
-            f.is_rtr = frame.can_id & CAN_RTR_FLAG;
-            f.data.resize(frame.len);
+size_t LinuxSocketCanReceiver::receive_batch()
+{
+    size_t count = read_batch(rx_batch_);
+    if (count == 0)
+        return 0;
 
-            std::memcpy(f.data.data(), frame.data, frame.len);
+    rx_frames_.add(count);
+    dispatch({rx_batch_.data(), count});
+    return count;
+}
 
-            std::vector<Callback> callbacks_copy;
+size_t LinuxSocketCanReceiver::read_batch(std::span<CanFrame> frames)
+{
+    const size_t capacity = frames.size();
+    const auto deadline = std::chrono::steady_clock::now() + options_.max_wait;
+    size_t count = 0;
+
+    while (count < capacity) {
+        // The kernel shrinks msg_controllen to what it wrote, hand the free slots their full buffers again
+        for (size_t i = count; i < rx_control_.size() && i < capacity; ++i) {
+            rx_msgs_[i].msg_hdr.msg_control = rx_control_[i].data;
+            rx_msgs_[i].msg_hdr.msg_controllen = sizeof(rx_control_[i].data);
+        }
 
-            {
-                std::lock_guard lock(mutex_);
-                for (auto& [_, cb] : subscribers_)
-                    callbacks_copy.push_back(cb);
+        // Slot i of rx_msgs_ always points at rx_raw_[i], receive straight into the free tail
+        int n = ::recvmmsg(socket_fd_, rx_msgs_.data() + count, capacity - count, MSG_DONTWAIT, nullptr);
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            if (errno != EAGAIN && errno != EWOULDBLOCK) {
+                LOG_ERROR(log_module, "{}: recvmmsg() error: {}", ifname_, std::strerror(errno));
+                rx_errors_.add();
             }
+            n = 0;
+        }
+
+        const size_t end = count + static_cast<size_t>(n);
+        for (size_t i = count; i < end; ++i) {
+            // msg_len tells classic (CAN_MTU) and FD (CANFD_MTU) frames apart
+            if (from_linux_frame(rx_raw_[i], rx_msgs_[i].msg_len, frames[count])) {
+                if (!rx_control_.empty())
+                    frames[count].timestamp_ns = receive_timestamp_ns(rx_msgs_[i].msg_hdr);
+                ++count;
+            } else {
+                rx_errors_.add();
+            }
+        }
+
+        if (count == capacity || options_.max_wait.count() <= 0 || !running_.load())
+            break;
+
+        // Batch not full yet, wait for more frames until the deadline
+        auto remaining = std::chrono::duration_cast<std::chrono::nanoseconds>(deadline - std::chrono::steady_clock::now());
+        if (remaining.count() <= 0)
+            break;
+
+        struct timespec timeout{};
+        timeout.tv_sec = remaining.count() / 1000000000;
+        timeout.tv_nsec = remaining.count() % 1000000000;
+
+        struct pollfd pfd{};
+        pfd.fd = socket_fd_;
+        pfd.events = POLLIN;
+        if (::ppoll(&pfd, 1, &timeout, nullptr) <= 0)
+            break;
+    }
+
+    return count;
+}
+
+void LinuxSocketCanReceiver::dispatch(std::span<const CanFrame> frames)
+{
+    // One snapshot per batch: no lock and no allocation on the receive path
+    const auto subscribers = subscribers_.load(std::memory_order_acquire);
+
+    for (const auto& [_, cb] : subscribers->batch) {
+        try {
+            cb(frames);
+        } catch (const std::exception& e) {
+            LOG_ERROR(log_module, "Subscriber callback threw: {}", e.what());
+        } catch (...) {
+            LOG_ERROR(log_module, "Subscriber callback threw unknown exception");
+        }
+    }
 
-            for (auto& cb : callbacks_copy) {
-                try {
-                    cb(f);
-                } catch (const std::exception& e) {
-                    std::cerr << "Subscriber callback threw: " << e.what() << std::endl;
-                } catch (...) {
-                    std::cerr << "Subscriber callback threw unknown exception" << std::endl;
-                }
+    for (const auto& f : frames) {
+        for (const auto& [_, cb] : subscribers->frame) {
+            try {
+                cb(f);
+            } catch (const std::exception& e) {
+                LOG_ERROR(log_module, "Subscriber callback threw: {}", e.what());
+            } catch (...) {
+                LOG_ERROR(log_module, "Subscriber callback threw unknown exception");
             }
         }
     }
-    std::cout << "Worker thread exiting" << std::endl;
 }
@@ -25,18 +25,26 @@
 
 #include <atomic>
 #include <cstring>
+#include <memory>
 #include <mutex>
 #include <thread>
 #include <vector>
 
+#include <linux/can.h>
+#include <sys/socket.h>
+
 #include "can/ican_receiver.h"
+#include "metrics/metrics.h"
 
 
 class LinuxSocketCanReceiver : public ICanReceiver
 {
 public:
-    explicit LinuxSocketCanReceiver(std::string ifname)
+    explicit LinuxSocketCanReceiver(std::string ifname, CanReceiveOptions options = {})
         : ifname_(std::move(ifname))
+        , options_(std::move(options))
+        , rx_frames_(MetricsRegistry::instance().counter("can_rx_frames_total", "CAN frames received", {{"interface", ifname_}}))
+        , rx_errors_(MetricsRegistry::instance().counter("can_rx_errors_total", "CAN receive errors and malformed frames", {{"interface", ifname_}}))
     {
     }
 
@@ -63,20 +71,62 @@ public:
     }
 
     SubscriptionPtr subscribe(Callback cb) override;
+    SubscriptionPtr subscribe_batch(BatchCallback cb) override;
+
+    bool set_filters(std::span<const CanFilter> filters) override;
+
+protected:
+    // Sizes the receive buffers for options_.batch_size, call before the first receive_batch()
+    void prepare_buffers();
+
+    // Reads up to one batch (waiting up to options_.max_wait for it to fill) and hands it to
+    // the subscribers. Returns the number of frames delivered.
+    size_t receive_batch();
+
+    // Hands received frames to the current subscribers, on the receiving thread
+    void dispatch(std::span<const CanFrame> frames);
 
 private:
+    // Immutable subscriber list, replaced as a whole on (un)subscribe
+    struct Subscribers
+    {
+        std::vector<std::pair<uint64_t, Callback>> frame;
+        std::vector<std::pair<uint64_t, BatchCallback>> batch;
+    };
+
+    void enable_timestamps();
+    bool apply_filters();
+    SubscriptionPtr make_subscription(uint64_t id);
     void unsubscribe(uint64_t id);
 
     void receive_loop();
+    size_t read_batch(std::span<CanFrame> frames);
 
-private:
+protected:
     std::string ifname_;
+    CanReceiveOptions options_;
     int socket_fd_{-1};
-
     std::atomic<bool> running_{false};
+    Counter& rx_frames_;
+    Counter& rx_errors_;
+
+private:
     std::thread worker_;
 
-    std::mutex mutex_;
-    std::vector<std::pair<uint64_t, Callback>> subscribers_;
+    // recvmmsg() scatter buffers, owned by the receiving thread
+    std::vector<CanFrame> rx_batch_;
+    std::vector<struct canfd_frame> rx_raw_;
+    std::vector<struct iovec> rx_iov_;
+    std::vector<struct mmsghdr> rx_msgs_;
+
+    // Per-slot control buffer for the receive timestamp, only allocated when timestamps are enabled
+    struct ControlBuffer {
+        alignas(struct cmsghdr) char data[CMSG_SPACE(sizeof(struct timespec) * 3)];
+    };
+    std::vector<ControlBuffer> rx_control_;
+
+    std::mutex mutex_;  // serializes writers: subscribe/unsubscribe and filter updates
+    std::atomic<std::shared_ptr<const Subscribers>> subscribers_{std::make_shared<const Subscribers>()};
+    std::vector<CanFilter> filters_;
     uint64_t next_id_{0};
 };
@@ -22,17 +22,23 @@
  */
 
 #include "can/linux/sockets/can_sender.h"
+#include "can/linux/sockets/can_frame_conversion.h"
 
+#include <algorithm>
 #include <cstring>
+#include <cerrno>
 #include <unistd.h>
-#include <iostream>
 
 #include <sys/socket.h>
 #include <linux/can.h>
 #include <linux/can/raw.h>
 #include <net/if.h>
 #include <sys/ioctl.h>
+#include <sys/uio.h>
 
+#include "logging/logger.h"
+
+static LogModule log_module("can");
 
 bool LinuxSocketCanSender::open() {
     
@@ -46,6 +52,13 @@ bool LinuxSocketCanSender::open() {
         return false;
     }
 
+    // Needed to write FD frames, classic frames still work if the kernel refuses
+    int enable_fd = 1;
+    fd_enabled_ = setsockopt(sock_, SOL_CAN_RAW, CAN_RAW_FD_FRAMES, &enable_fd, sizeof(enable_fd)) == 0;
+    if (!fd_enabled_) {
+        LOG_WARN(log_module, "{}: CAN-FD frames not supported: {}", ifname_, std::strerror(errno));
+    }
+
     struct sockaddr_can addr{};
     addr.can_family = AF_CAN;
     addr.can_ifindex = ifr.ifr_ifindex;
@@ -66,19 +79,93 @@ void LinuxSocketCanSender::close() {
 }
 
 bool LinuxSocketCanSender::send(const CanFrame& frame) {
-    if (!open_) {
+    if (!open_ || (frame.is_fd && !fd_enabled_)) {
+        tx_errors_.add();
         return false;
     }
 
-    struct can_frame cf{};
-    cf.can_id = frame.id | (frame.is_extended ? CAN_EFF_FLAG : 0);
-    cf.can_dlc = frame.data.size();
-    std::memcpy(cf.data, frame.data.data(), cf.can_dlc);
-    int nbytes = 0;
+    struct canfd_frame cf{};
+    size_t mtu = to_linux_frame(frame, cf);
+    ssize_t nbytes = 0;
+    {
+        std::lock_guard<std::mutex> lock(send_mutex_);
+        nbytes = write(sock_, &cf, mtu);
+    }
+
+    const bool ok = nbytes == static_cast<ssize_t>(mtu);
+    (ok ? tx_frames_ : tx_errors_).add();
+    return ok;
+}
+
+size_t LinuxSocketCanSender::send_batch(std::span<const CanFrame> frames) {
+    if (!open_) {
+        tx_errors_.add(frames.size());
+        return 0;
+    }
+
+    size_t sent = 0;
     {
         std::lock_guard<std::mutex> lock(send_mutex_);
-        nbytes = write(sock_, &cf, CAN_MTU);
+        sent = send_batch_locked(frames);
+    }
+
+    tx_frames_.add(sent);
+    if (sent < frames.size()) {
+        tx_errors_.add(frames.size() - sent);
+    }
+    return sent;
+}
+
+size_t LinuxSocketCanSender::sendable(std::span<const CanFrame> frames) const {
+    size_t usable = 0;
+    while (usable < frames.size() && (!frames[usable].is_fd || fd_enabled_)) {
+        ++usable;
+    }
+    return usable;
+}
+
+size_t LinuxSocketCanSender::send_batch_locked(std::span<const CanFrame> frames) {
+    size_t sent = 0;
+    while (sent < frames.size()) {
+        // sendmmsg() takes at most UIO_MAXIOV messages per call
+        auto chunk = frames.subspan(sent, std::min<size_t>(frames.size() - sent, UIO_MAXIOV));
+        if (tx_msgs_.size() < chunk.size()) {
+            tx_raw_.resize(chunk.size());
+            tx_iov_.resize(chunk.size());
+            tx_msgs_.resize(chunk.size());
+        }
+
+        // FD frames on a socket without FD support end the batch, like a failed send()
+        const size_t usable = sendable(chunk);
+        if (usable < chunk.size()) {
+            chunk = chunk.first(usable);
+            if (chunk.empty()) {
+                return sent;
+            }
+        }
+
+        for (size_t i = 0; i < chunk.size(); ++i) {
+            tx_iov_[i].iov_base = &tx_raw_[i];
+            tx_iov_[i].iov_len = to_linux_frame(chunk[i], tx_raw_[i]);
+            tx_msgs_[i] = {};
+            tx_msgs_[i].msg_hdr.msg_iov = &tx_iov_[i];
+            tx_msgs_[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        size_t done = 0;
+        while (done < chunk.size()) {
+            int n = ::sendmmsg(sock_, tx_msgs_.data() + done, chunk.size() - done, 0);
+            if (n < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                // ENOBUFS etc., report what went out and let the caller retry the tail
+                return sent + done;
+            }
+            done += static_cast<size_t>(n);
+        }
+        sent += done;
     }
 
-    return nbytes == CAN_MTU;
+    return sent;
 }
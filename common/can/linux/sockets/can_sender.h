@@ -26,14 +26,21 @@
 #include <string>
 #include <utility>
 #include <mutex>
+#include <vector>
+
+#include <linux/can.h>
+#include <sys/socket.h>
 
 #include "can/ican_sender.h"
+#include "metrics/metrics.h"
 
 
 class LinuxSocketCanSender : public ICanSender {
 public:
     explicit LinuxSocketCanSender(std::string ifname)
-        : ifname_(std::move(ifname)) {}
+        : ifname_(std::move(ifname))
+        , tx_frames_(MetricsRegistry::instance().counter("can_tx_frames_total", "CAN frames written", {{"interface", ifname_}}))
+        , tx_errors_(MetricsRegistry::instance().counter("can_tx_errors_total", "CAN frames that could not be written", {{"interface", ifname_}})) {}
 
     bool open() override;
 
@@ -41,17 +48,39 @@ public:
 
     bool send(const CanFrame& frame) override;
 
+    size_t send_batch(std::span<const CanFrame> frames) override;
+
     bool is_open() const override {
         return open_;
     }
 
+    bool fd_enabled() const {
+        return fd_enabled_;
+    }
+
     std::string name() const override {
         return ifname_;
     }
 
-private:
+protected:
+    // Writes frames in order with send_mutex_ held, returns how many went out
+    virtual size_t send_batch_locked(std::span<const CanFrame> frames);
+
+    // Length of the leading run of frames this socket can write (FD frames need FD support)
+    size_t sendable(std::span<const CanFrame> frames) const;
+
+protected:
     std::string ifname_;
+    Counter& tx_frames_;
+    Counter& tx_errors_;
     int sock_{-1};
     bool open_{false};
+    bool fd_enabled_{false};
     std::mutex send_mutex_;
+
+private:
+    // sendmmsg() gather buffers, guarded by send_mutex_
+    std::vector<struct canfd_frame> tx_raw_;
+    std::vector<struct iovec> tx_iov_;
+    std::vector<struct mmsghdr> tx_msgs_;
 };
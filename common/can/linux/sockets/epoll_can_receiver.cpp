@@ -0,0 +1,97 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+
+#include "can/linux/sockets/epoll_can_receiver.h"
+
+#include "logging/logger.h"
+
+
+static LogModule log_module("can");
+
+namespace {
+    // A reactor thread is shared, it must never sit in a receive waiting for a batch to fill
+    CanReceiveOptions non_blocking(const std::string& ifname, CanReceiveOptions options)
+    {
+        if (options.max_wait.count() > 0) {
+            LOG_INFO(log_module, "{}: rx max wait ignored by the epoll backend", ifname);
+            options.max_wait = std::chrono::microseconds(0);
+        }
+        return options;
+    }
+}
+
+EpollCanReceiver::EpollCanReceiver(std::string ifname, std::shared_ptr<EpollReactor> reactor, CanReceiveOptions options)
+    : LinuxSocketCanReceiver(ifname, non_blocking(ifname, std::move(options)))
+    , reactor_(std::move(reactor))
+{
+}
+
+bool EpollCanReceiver::start()
+{
+    if (!is_open() || registered_)
+        return false;
+
+    prepare_buffers();
+    running_.store(true);
+    registered_ = reactor_->add(socket_fd_, [this]()
+    {
+        if (running_.load(std::memory_order_relaxed))
+            receive_batch();
+    });
+
+    if (!registered_) {
+        running_.store(false);
+        return false;
+    }
+    return true;
+}
+
+void EpollCanReceiver::stop()
+{
+    // Called from signal handlers: only flag and wake, wait() unregisters
+    running_.store(false);
+    running_.notify_all();
+}
+
+void EpollCanReceiver::wait()
+{
+    running_.wait(true);
+
+    if (registered_) {
+        reactor_->remove(socket_fd_);
+        registered_ = false;
+    }
+}
+
+void EpollCanReceiver::close()
+{
+    running_.store(false);
+    running_.notify_all();
+
+    // The reactor must be done with the socket before it is closed and its number reused
+    if (registered_) {
+        reactor_->remove(socket_fd_);
+        registered_ = false;
+    }
+    LinuxSocketCanReceiver::close();
+}
@@ -0,0 +1,53 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+
+#pragma once
+
+#include <memory>
+
+#include "can/linux/sockets/can_receiver.h"
+#include "can/linux/sockets/epoll_reactor.h"
+
+
+// SocketCAN receiver without a thread of its own: the socket is served by a shared
+// EpollReactor, one batch per readiness report so that busy interfaces cannot starve
+// the others on the same reactor thread.
+class EpollCanReceiver : public LinuxSocketCanReceiver
+{
+public:
+    EpollCanReceiver(std::string ifname, std::shared_ptr<EpollReactor> reactor, CanReceiveOptions options = {});
+
+    ~EpollCanReceiver() override
+    {
+        close();
+    }
+
+    bool start() override;
+    void stop() override;
+    void close() override;
+    void wait() override;
+
+private:
+    std::shared_ptr<EpollReactor> reactor_;
+    bool registered_{false};
+};
@@ -0,0 +1,182 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+
+#include "can/linux/sockets/epoll_reactor.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include "logging/logger.h"
+
+
+static LogModule log_module("can");
+
+namespace {
+    constexpr int max_events = 64;
+}
+
+EpollReactor::EpollReactor(size_t threads)
+{
+    for (size_t i = 0; i < std::max<size_t>(threads, 1); ++i) {
+        auto loop = std::make_unique<Loop>();
+        loop->epoll_fd = ::epoll_create1(EPOLL_CLOEXEC);
+        loop->wake_fd = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+        if (loop->epoll_fd < 0 || loop->wake_fd < 0) {
+            LOG_ERROR(log_module, "epoll reactor setup failed: {}", std::strerror(errno));
+        } else {
+            struct epoll_event ev{};
+            ev.events = EPOLLIN;
+            ev.data.fd = loop->wake_fd;
+            ::epoll_ctl(loop->epoll_fd, EPOLL_CTL_ADD, loop->wake_fd, &ev);
+        }
+        loops_.push_back(std::move(loop));
+    }
+}
+
+EpollReactor::~EpollReactor()
+{
+    stop();
+    for (auto& loop : loops_) {
+        if (loop->wake_fd >= 0)
+            ::close(loop->wake_fd);
+        if (loop->epoll_fd >= 0)
+            ::close(loop->epoll_fd);
+    }
+}
+
+bool EpollReactor::start()
+{
+    if (running_.exchange(true))
+        return true;
+
+    for (auto& loop : loops_) {
+        if (loop->epoll_fd < 0 || loop->wake_fd < 0) {
+            stop();
+            return false;
+        }
+        loop->thread = std::thread(&EpollReactor::run, this, std::ref(*loop));
+    }
+    LOG_INFO(log_module, "epoll reactor running with {} thread(s)", loops_.size());
+    return true;
+}
+
+void EpollReactor::stop()
+{
+    running_.store(false);
+    for (auto& loop : loops_) {
+        if (loop->wake_fd >= 0) {
+            uint64_t one = 1;
+            [[maybe_unused]] ssize_t n = ::write(loop->wake_fd, &one, sizeof(one));
+        }
+    }
+    for (auto& loop : loops_) {
+        if (loop->thread.joinable())
+            loop->thread.join();
+    }
+}
+
+bool EpollReactor::add(int fd, ReadyCallback on_readable)
+{
+    Loop* loop = nullptr;
+    {
+        std::lock_guard lock(mutex_);
+        if (assigned_.count(fd))
+            return false;
+
+        // Least loaded thread, ties go to the lowest index
+        std::vector<size_t> load(loops_.size(), 0);
+        for (const auto& [_, l] : assigned_) {
+            for (size_t i = 0; i < loops_.size(); ++i) {
+                if (loops_[i].get() == l)
+                    ++load[i];
+            }
+        }
+        loop = loops_[std::min_element(load.begin(), load.end()) - load.begin()].get();
+        assigned_[fd] = loop;
+    }
+
+    std::lock_guard lock(loop->mutex);
+    loop->handlers[fd] = std::move(on_readable);
+
+    struct epoll_event ev{};
+    ev.events = EPOLLIN;
+    ev.data.fd = fd;
+    if (::epoll_ctl(loop->epoll_fd, EPOLL_CTL_ADD, fd, &ev) < 0) {
+        LOG_ERROR(log_module, "epoll_ctl(ADD) failed: {}", std::strerror(errno));
+        loop->handlers.erase(fd);
+        std::lock_guard assign_lock(mutex_);
+        assigned_.erase(fd);
+        return false;
+    }
+    return true;
+}
+
+void EpollReactor::remove(int fd)
+{
+    Loop* loop = nullptr;
+    {
+        std::lock_guard lock(mutex_);
+        auto it = assigned_.find(fd);
+        if (it == assigned_.end())
+            return;
+        loop = it->second;
+        assigned_.erase(it);
+    }
+
+    // Waits for a running callback round to finish
+    std::lock_guard lock(loop->mutex);
+    ::epoll_ctl(loop->epoll_fd, EPOLL_CTL_DEL, fd, nullptr);
+    loop->handlers.erase(fd);
+}
+
+void EpollReactor::run(Loop& loop)
+{
+    struct epoll_event events[max_events];
+
+    while (running_.load()) {
+        int n = ::epoll_wait(loop.epoll_fd, events, max_events, -1);
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            LOG_ERROR(log_module, "epoll_wait() error: {}", std::strerror(errno));
+            break;
+        }
+
+        // One callback per ready socket and round, a socket removed meanwhile is skipped
+        std::lock_guard lock(loop.mutex);
+        for (int i = 0; i < n; ++i) {
+            const int fd = events[i].data.fd;
+            if (fd == loop.wake_fd)
+                continue;
+
+            auto it = loop.handlers.find(fd);
+            if (it != loop.handlers.end())
+                it->second();
+        }
+    }
+}
@@ -0,0 +1,79 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+
+// Serves readable sockets from a small, fixed set of threads. Every socket is pinned to one
+// thread (the least loaded when it is added), so its callback never runs concurrently with
+// itself. Sockets are level triggered and a callback is expected to consume a bounded amount
+// of input per call; a busy socket is reported again on the next round, after every other
+// ready socket of its thread had its turn.
+class EpollReactor
+{
+public:
+    using ReadyCallback = std::function<void()>;
+
+    explicit EpollReactor(size_t threads = 1);
+    ~EpollReactor();
+
+    EpollReactor(const EpollReactor&) = delete;
+    EpollReactor& operator=(const EpollReactor&) = delete;
+
+    bool start();
+    void stop();
+
+    // `on_readable` runs on the socket's reactor thread whenever `fd` has input
+    bool add(int fd, ReadyCallback on_readable);
+
+    // Once this returns the callback of `fd` is not running and will not run again
+    void remove(int fd);
+
+    size_t thread_count() const { return loops_.size(); }
+
+private:
+    struct Loop {
+        int epoll_fd{-1};
+        int wake_fd{-1};    // eventfd, wakes epoll_wait on stop()
+        std::thread thread;
+        std::mutex mutex;   // held while callbacks run, add/remove wait for it
+        std::unordered_map<int, ReadyCallback> handlers;
+    };
+
+    void run(Loop& loop);
+
+private:
+    std::vector<std::unique_ptr<Loop>> loops_;
+    std::atomic<bool> running_{false};
+    std::mutex mutex_;  // fd -> loop assignment
+    std::unordered_map<int, Loop*> assigned_;
+};
@@ -0,0 +1,182 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+
+// What a full ring does with a new item
+enum class OverflowPolicy {
+    Block,          // producer waits until the consumer frees a slot, or the ring is closed
+    DropOldest,     // oldest queued item is discarded to make room
+    DropNewest,     // new item is discarded
+};
+
+// Bounded lock-free ring for exactly one producer thread and one consumer thread.
+// Capacity is rounded up to a power of two. Items are copied in and out as relaxed
+// atomic words: with DropOldest the producer may overwrite a slot the consumer is
+// still copying, and the consumer then discards that copy.
+template<typename T>
+class SpscRing
+{
+    static_assert(std::is_trivially_copyable_v<T>, "SpscRing slots are copied word by word");
+
+public:
+    explicit SpscRing(size_t capacity, OverflowPolicy policy = OverflowPolicy::DropNewest)
+        : slots_(round_up_pow2(capacity))
+        , mask_(slots_.size() - 1)
+        , policy_(policy)
+    {
+    }
+
+    SpscRing(const SpscRing&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+
+    // Producer side. Returns false if `item` itself was dropped.
+    bool push(const T& item)
+    {
+        const uint64_t tail = tail_.load(std::memory_order_relaxed);
+
+        while (tail - head_cache_ > mask_) {
+            head_cache_ = head_.load(std::memory_order_acquire);
+            if (tail - head_cache_ <= mask_)
+                break;
+
+            switch (policy_) {
+            case OverflowPolicy::DropNewest:
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            case OverflowPolicy::DropOldest:
+                // Claim the oldest slot from the consumer, pop() notices the lost race and retries
+                if (head_.compare_exchange_weak(head_cache_, head_cache_ + 1, std::memory_order_acq_rel)) {
+                    ++head_cache_;
+                    dropped_.fetch_add(1, std::memory_order_relaxed);
+                }
+                break;
+            case OverflowPolicy::Block:
+                // A consumer that stopped draining must not hang the producer on shutdown
+                if (closed_.load(std::memory_order_relaxed)) {
+                    dropped_.fetch_add(1, std::memory_order_relaxed);
+                    return false;
+                }
+                std::this_thread::yield();
+                break;
+            }
+        }
+
+        store(slots_[tail & mask_], item);
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side. Returns false if the ring is empty.
+    bool pop(T& out)
+    {
+        uint64_t head = head_.load(std::memory_order_acquire);
+
+        for (;;) {
+            // The producer may have moved head past our cached tail by dropping items
+            if (head >= tail_cache_) {
+                tail_cache_ = tail_.load(std::memory_order_acquire);
+                if (head >= tail_cache_)
+                    return false;
+            }
+
+            // With DropOldest the producer may reclaim this slot while it is copied,
+            // the copy is only kept if head did not move in the meantime
+            load(slots_[head & mask_], out);
+            if (head_.compare_exchange_strong(head, head + 1, std::memory_order_acq_rel))
+                return true;
+        }
+    }
+
+    // Any thread. A full Block ring then drops new items instead of waiting.
+    void close() { closed_.store(true, std::memory_order_relaxed); }
+
+    size_t capacity() const { return slots_.size(); }
+
+    size_t size() const
+    {
+        const uint64_t head = head_.load(std::memory_order_acquire);
+        const uint64_t tail = tail_.load(std::memory_order_acquire);
+        return tail > head ? static_cast<size_t>(tail - head) : 0;
+    }
+
+    uint64_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+private:
+    static constexpr size_t words = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+    struct Slot {
+        std::atomic<uint64_t> word[words];
+    };
+
+    static void store(Slot& slot, const T& item)
+    {
+        uint64_t buffer[words] = {};
+        std::memcpy(buffer, &item, sizeof(T));
+        for (size_t i = 0; i < words; ++i)
+            slot.word[i].store(buffer[i], std::memory_order_relaxed);
+    }
+
+    static void load(const Slot& slot, T& out)
+    {
+        uint64_t buffer[words];
+        for (size_t i = 0; i < words; ++i)
+            buffer[i] = slot.word[i].load(std::memory_order_relaxed);
+        std::memcpy(&out, buffer, sizeof(T));
+    }
+
+    static size_t round_up_pow2(size_t n)
+    {
+        size_t p = 2;
+        while (p < n)
+            p <<= 1;
+        return p;
+    }
+
+private:
+    static constexpr size_t cache_line = 64;
+
+    std::vector<Slot> slots_;
+    const uint64_t mask_;
+    const OverflowPolicy policy_;
+
+    // Indices only grow and are 64-bit so they never wrap, slot = index & mask_
+    alignas(cache_line) std::atomic<uint64_t> head_{0};  // next slot to read, advanced by the consumer
+    uint64_t tail_cache_{0};                             // consumer's last view of tail_
+
+    alignas(cache_line) std::atomic<uint64_t> tail_{0};  // next slot to write, advanced by the producer
+    uint64_t head_cache_{0};                             // producer's last view of head_
+
+    alignas(cache_line) std::atomic<uint64_t> dropped_{0};
+    std::atomic<bool> closed_{false};
+};
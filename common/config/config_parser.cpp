@@ -25,7 +25,10 @@
 
 #include <fstream>
 #include <filesystem>
-#include <iostream>
+
+#include "logging/logger.h"
+
+static LogModule log_module("config");
 
 namespace {
     struct settings {
@@ -44,7 +47,7 @@ namespace {
                 if (i + 1 < args.size()) {
                     s.config_file = args[++i];
                 } else {
-                    std::cerr << "Error: --config requires a filename argument" << std::endl;
+                    LOG_ERROR(log_module, "Error: --config requires a filename argument");
                     return std::nullopt;
                 }
             }
@@ -58,15 +61,15 @@ std::optional<nlohmann::json> load_config(int argc, char* argv[]) {
     auto args = parse_args({argv, static_cast<size_t>(argc)});
 
     if (args && !args->config_file.empty()) {
-        std::cout << "Loading config from: " << args->config_file << std::endl;
+        LOG_INFO(log_module, "Loading config from: {}", args->config_file);
     } else {
-        std::cout << "No config file provided. Using defaults." << std::endl;
+        LOG_WARN(log_module, "No config file provided. Using defaults.");
         return std::nullopt;
     }
 
     std::ifstream config_file(std::filesystem::path(args->config_file));
     if (!config_file) {
-        std::cerr << "Failed to open config file: " << args->config_file << std::endl;
+        LOG_ERROR(log_module, "Failed to open config file: {}", args->config_file);
         return std::nullopt;
     }
 
@@ -76,7 +79,7 @@ std::optional<nlohmann::json> load_config(int argc, char* argv[]) {
     if (nlohmann::json::accept(content)) {
         return nlohmann::json::parse(content);  // parse content into the json object
     } else {
-        std::cerr << "Failed to parse config file: content is not valid JSON" << std::endl;
+        LOG_ERROR(log_module, "Failed to parse config file: content is not valid JSON");
         return std::nullopt;
     }
 }
@@ -0,0 +1,389 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+
+#include "logging/logger.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <ctime>
+#include <cctype>
+
+
+struct Logger::ThreadBuffer {
+    explicit ThreadBuffer(uint32_t id)
+        : thread_id(id)
+    {
+    }
+
+    SpscRing<LogRecord> ring{1024, OverflowPolicy::DropNewest};
+    uint32_t thread_id;
+    std::atomic<bool> retired{false};
+};
+
+namespace {
+    constexpr auto writer_period = std::chrono::milliseconds(2);
+
+    // Marks the calling thread's buffer as retired when the thread exits,
+    // the writer frees it once it is drained
+    struct ThreadBufferHolder {
+        std::shared_ptr<void> owner;
+        std::atomic<bool>* retired{nullptr};
+
+        ~ThreadBufferHolder() {
+            if (retired) {
+                retired->store(true);
+            }
+        }
+    };
+
+    const char* level_name(LogLevel level) {
+        switch (level) {
+            case LogLevel::Trace: return "TRACE";
+            case LogLevel::Debug: return "DEBUG";
+            case LogLevel::Info: return "INFO ";
+            case LogLevel::Warn: return "WARN ";
+            case LogLevel::Error: return "ERROR";
+            default: return "     ";
+        }
+    }
+
+    void append_printf(std::string& out, const char* fmt, auto... values) {
+        char buf[128];
+        int n = std::snprintf(buf, sizeof(buf), fmt, values...);
+        if (n > 0) {
+            out.append(buf, std::min<size_t>(static_cast<size_t>(n), sizeof(buf) - 1));
+        }
+    }
+
+    // Formats one argument, `spec` is what follows ':' inside the braces
+    void append_arg(std::string& out, const LogRecord& record, const LogArg& arg, std::string_view spec) {
+        // Split "08.3f" into flags/width/precision and a conversion character
+        char conversion = 0;
+        if (!spec.empty() && std::isalpha(static_cast<unsigned char>(spec.back()))) {
+            conversion = spec.back();
+            spec.remove_suffix(1);
+        }
+        std::string fmt = "%";
+        fmt.append(spec.substr(0, 16));
+
+        switch (arg.type) {
+            case LogArg::Type::Int:
+                fmt += (conversion == 'x' || conversion == 'X') ? std::string("ll") + conversion : std::string("lld");
+                append_printf(out, fmt.c_str(), static_cast<long long>(arg.i));
+                break;
+            case LogArg::Type::UInt:
+                fmt += (conversion == 'x' || conversion == 'X') ? std::string("ll") + conversion : std::string("llu");
+                append_printf(out, fmt.c_str(), static_cast<unsigned long long>(arg.u));
+                break;
+            case LogArg::Type::Double:
+                fmt += (conversion == 'f' || conversion == 'e' || conversion == 'g') ? conversion : 'g';
+                append_printf(out, fmt.c_str(), arg.d);
+                break;
+            case LogArg::Type::Str:
+                out.append(record.arena + arg.offset, arg.size);
+                break;
+            case LogArg::Type::Bytes:
+                for (size_t i = 0; i < arg.size; ++i) {
+                    if (i > 0) {
+                        out.push_back(' ');
+                    }
+                    append_printf(out, "%02x", static_cast<unsigned>(static_cast<uint8_t>(record.arena[arg.offset + i])));
+                }
+                break;
+        }
+    }
+}
+
+LogModule::LogModule(std::string name)
+    : name_(std::move(name))
+{
+    Logger::instance().register_module(this);
+}
+
+LogModule::~LogModule()
+{
+    // Queued records point at this module, write them out before it goes away
+    Logger::instance().flush();
+    Logger::instance().unregister_module(this);
+}
+
+Logger& Logger::instance()
+{
+    static Logger logger;
+    return logger;
+}
+
+Logger::Logger()
+{
+    writer_ = std::thread(&Logger::writer_loop, this);
+}
+
+Logger::~Logger()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        running_ = false;
+    }
+    cv_.notify_all();
+    if (writer_.joinable()) {
+        writer_.join();
+    }
+}
+
+std::optional<LogLevel> Logger::parse_level(std::string_view name)
+{
+    if (name == "trace") return LogLevel::Trace;
+    if (name == "debug") return LogLevel::Debug;
+    if (name == "info") return LogLevel::Info;
+    if (name == "warn" || name == "warning") return LogLevel::Warn;
+    if (name == "error") return LogLevel::Error;
+    if (name == "off") return LogLevel::Off;
+    return std::nullopt;
+}
+
+void Logger::configure(const nlohmann::json& config)
+{
+    if (config.contains("level")) {
+        auto level = parse_level(config["level"].get<std::string>());
+        if (level) {
+            set_level(*level);
+        } else {
+            std::fprintf(stderr, "Unknown log level: %s\n", config["level"].get<std::string>().c_str());
+        }
+    }
+
+    if (config.contains("modules")) {
+        for (const auto& [module, value] : config["modules"].items()) {
+            auto level = parse_level(value.get<std::string>());
+            if (!level || !set_module_level(module, *level)) {
+                std::fprintf(stderr, "Invalid log level for module %s\n", module.c_str());
+            }
+        }
+    }
+}
+
+void Logger::set_level(LogLevel level)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    level_ = level;
+    for (auto* module : modules_) {
+        if (!module->overridden_) {
+            module->level_.store(level, std::memory_order_relaxed);
+        }
+    }
+}
+
+bool Logger::set_module_level(std::string_view name, LogLevel level)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    bool found = false;
+    for (auto* module : modules_) {
+        if (module->name_ == name) {
+            module->overridden_ = true;
+            module->level_.store(level, std::memory_order_relaxed);
+            found = true;
+        }
+    }
+    return found;
+}
+
+void Logger::register_module(LogModule* module)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    module->level_.store(level_, std::memory_order_relaxed);
+    modules_.push_back(module);
+}
+
+void Logger::unregister_module(LogModule* module)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::erase(modules_, module);
+}
+
+uint64_t Logger::dropped() const
+{
+    uint64_t total = retired_drops_.load();
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& buffer : buffers_) {
+        total += buffer->ring.dropped();
+    }
+    return total;
+}
+
+void Logger::push(LogRecord& record)
+{
+    // First log call on a thread registers its buffer, later calls touch only the ring
+    thread_local ThreadBufferHolder holder;
+    thread_local ThreadBuffer* buffer = nullptr;
+
+    if (!buffer) {
+        auto owned = std::make_shared<ThreadBuffer>(next_thread_id_.fetch_add(1) + 1);
+        buffer = owned.get();
+        holder.retired = &owned->retired;
+        holder.owner = owned;
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        buffers_.push_back(std::move(owned));
+    }
+
+    record.thread_id = buffer->thread_id;
+    buffer->ring.push(record);
+}
+
+void Logger::flush()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    const uint64_t target = ++flush_requested_;
+    cv_.notify_all();
+    cv_.wait(lock, [this, target] { return flush_done_ >= target || !running_; });
+}
+
+void Logger::writer_loop()
+{
+    std::vector<LogRecord> records;
+    std::string out;
+    std::string err;
+    uint64_t reported_drops = 0;
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        cv_.wait_for(lock, writer_period, [this] { return !running_ || flush_requested_ > flush_done_; });
+        const bool stopping = !running_;
+        const uint64_t flush_target = flush_requested_;
+
+        lock.unlock();
+        write_pending(records, out, err);
+
+        const uint64_t drops = dropped();
+        if (drops != reported_drops) {
+            std::fprintf(stderr, "Logger: %llu log records dropped\n", static_cast<unsigned long long>(drops - reported_drops));
+            reported_drops = drops;
+        }
+        lock.lock();
+
+        flush_done_ = flush_target;
+        cv_.notify_all();
+
+        if (stopping) {
+            break;
+        }
+    }
+}
+
+bool Logger::write_pending(std::vector<LogRecord>& records, std::string& out, std::string& err)
+{
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        buffers = buffers_;
+    }
+
+    records.clear();
+    for (const auto& buffer : buffers) {
+        LogRecord record;
+        while (buffer->ring.pop(record)) {
+            records.push_back(record);
+        }
+    }
+
+    // Drop buffers of exited threads once they are empty
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::erase_if(buffers_, [this](const auto& buffer) {
+            if (buffer->retired.load() && buffer->ring.size() == 0) {
+                retired_drops_.fetch_add(buffer->ring.dropped());
+                return true;
+            }
+            return false;
+        });
+    }
+
+    if (records.empty()) {
+        return false;
+    }
+
+    // Merge the per-thread streams in time order
+    std::stable_sort(records.begin(), records.end(), [](const LogRecord& a, const LogRecord& b) {
+        return a.timestamp_ns < b.timestamp_ns;
+    });
+
+    out.clear();
+    err.clear();
+    for (const auto& record : records) {
+        format_record(record, record.level >= LogLevel::Warn ? err : out);
+    }
+
+    if (!out.empty()) {
+        std::fwrite(out.data(), 1, out.size(), stdout);
+        std::fflush(stdout);
+    }
+    if (!err.empty()) {
+        std::fwrite(err.data(), 1, err.size(), stderr);
+        std::fflush(stderr);
+    }
+    return true;
+}
+
+void Logger::format_record(const LogRecord& record, std::string& out)
+{
+    const time_t seconds = static_cast<time_t>(record.timestamp_ns / 1000000000);
+    const unsigned micros = static_cast<unsigned>((record.timestamp_ns % 1000000000) / 1000);
+    struct tm tm {};
+    localtime_r(&seconds, &tm);
+
+    char prefix[64];
+    size_t n = std::strftime(prefix, sizeof(prefix), "%Y-%m-%d %H:%M:%S", &tm);
+    out.append(prefix, n);
+    append_printf(out, ".%06u %s [%u] ", micros, level_name(record.level), record.thread_id);
+    out.append(record.module->name());
+    out.append(": ");
+
+    // Substitute {} / {:spec} placeholders, {{ and }} are literal braces
+    size_t next_arg = 0;
+    for (const char* p = record.format; *p; ++p) {
+        if (p[0] == '{' && p[1] == '{') {
+            out.push_back('{');
+            ++p;
+        } else if (p[0] == '}' && p[1] == '}') {
+            out.push_back('}');
+            ++p;
+        } else if (p[0] == '{') {
+            const char* close = std::strchr(p, '}');
+            if (!close) {
+                out.append(p);
+                break;
+            }
+            std::string_view spec(p + 1, static_cast<size_t>(close - p - 1));
+            if (!spec.empty() && spec.front() == ':') {
+                spec.remove_prefix(1);
+            }
+            if (next_arg < record.argc) {
+                append_arg(out, record, record.args[next_arg++], spec);
+            }
+            p = close;
+        } else {
+            out.push_back(*p);
+        }
+    }
+    out.push_back('\n');
+}
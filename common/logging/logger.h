@@ -0,0 +1,232 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "concurrency/spsc_ring.h"
+
+
+enum class LogLevel : uint8_t {
+    Trace,
+    Debug,
+    Info,
+    Warn,
+    Error,
+    Off,
+};
+
+// Named log source with its own runtime level, declared once per translation unit:
+//   static LogModule log_module("can");
+class LogModule
+{
+public:
+    explicit LogModule(std::string name);
+    ~LogModule();
+
+    LogModule(const LogModule&) = delete;
+    LogModule& operator=(const LogModule&) = delete;
+
+    bool enabled(LogLevel level) const { return level >= level_.load(std::memory_order_relaxed); }
+
+    const std::string& name() const { return name_; }
+    LogLevel level() const { return level_.load(std::memory_order_relaxed); }
+
+private:
+    friend class Logger;
+
+    std::string name_;
+    std::atomic<LogLevel> level_{LogLevel::Info};
+    bool overridden_{false};    // level set per module, global level changes leave it alone
+};
+
+// Argument captured on the calling thread and formatted later on the writer thread
+struct LogArg {
+    enum class Type : uint8_t { Int, UInt, Double, Str, Bytes };
+
+    Type type;
+    uint8_t offset;     // Str/Bytes: position in LogRecord::arena
+    uint8_t size;
+    union {
+        int64_t i;
+        uint64_t u;
+        double d;
+    };
+};
+
+struct LogRecord {
+    static constexpr size_t max_args = 8;
+    static constexpr size_t arena_size = 160;
+
+    uint64_t timestamp_ns;
+    const char* format;         // string literal, {} placeholders with optional printf-like spec: {:x} {:.2f}
+    const LogModule* module;
+    uint32_t thread_id;
+    LogLevel level;
+    uint8_t argc;
+    uint8_t arena_used;
+    LogArg args[max_args];
+    char arena[arena_size];     // copied string and byte arguments
+};
+
+// Asynchronous logger. A log call checks the module level, copies its arguments into a
+// fixed-size record and pushes it into a lock-free per-thread ring; a background thread
+// formats and writes the records. When a ring is full the record is dropped and counted,
+// the calling thread never blocks on output.
+class Logger
+{
+public:
+    static Logger& instance();
+
+    // {"level": "info", "modules": {"can": "debug"}}, safe to call again at runtime
+    void configure(const nlohmann::json& config);
+
+    void set_level(LogLevel level);
+    bool set_module_level(std::string_view module, LogLevel level);
+
+    static std::optional<LogLevel> parse_level(std::string_view name);
+
+    template<typename... Args>
+    void log(const LogModule& module, LogLevel level, const char* format, const Args&... args)
+    {
+        static_assert(sizeof...(Args) <= LogRecord::max_args, "too many log arguments");
+
+        LogRecord record;
+        record.timestamp_ns = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count());
+        record.format = format;
+        record.module = &module;
+        record.level = level;
+        record.argc = 0;
+        record.arena_used = 0;
+        (capture(record, args), ...);
+
+        push(record);
+    }
+
+    // Blocks until everything logged before the call is written
+    void flush();
+
+    uint64_t dropped() const;
+
+private:
+    struct ThreadBuffer;
+
+    Logger();
+    ~Logger();
+
+    friend class LogModule;
+    void register_module(LogModule* module);
+    void unregister_module(LogModule* module);
+
+    void push(LogRecord& record);
+    void writer_loop();
+    bool write_pending(std::vector<LogRecord>& records, std::string& out, std::string& err);
+    static void format_record(const LogRecord& record, std::string& out);
+
+    template<typename T>
+    static void capture(LogRecord& record, const T& value)
+    {
+        LogArg& arg = record.args[record.argc++];
+        arg.offset = 0;
+        arg.size = 0;
+        arg.u = 0;
+
+        if constexpr (std::is_same_v<T, bool>) {
+            capture_bytes(record, arg, LogArg::Type::Str, value ? "true" : "false", value ? 4 : 5);
+        } else if constexpr (std::is_enum_v<T>) {
+            arg.type = LogArg::Type::Int;
+            arg.i = static_cast<int64_t>(value);
+        } else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+            arg.type = LogArg::Type::Int;
+            arg.i = value;
+        } else if constexpr (std::is_integral_v<T>) {
+            arg.type = LogArg::Type::UInt;
+            arg.u = value;
+        } else if constexpr (std::is_floating_point_v<T>) {
+            arg.type = LogArg::Type::Double;
+            arg.d = value;
+        } else if constexpr (std::is_convertible_v<const T&, std::span<const uint8_t>>) {
+            std::span<const uint8_t> bytes = value;
+            capture_bytes(record, arg, LogArg::Type::Bytes, bytes.data(), bytes.size());
+        } else if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+            std::string_view text = value;
+            capture_bytes(record, arg, LogArg::Type::Str, text.data(), text.size());
+        } else {
+            static_assert(std::is_void_v<T>, "unsupported log argument type");
+        }
+    }
+
+    // Copies into the record arena, truncating when it is full
+    static void capture_bytes(LogRecord& record, LogArg& arg, LogArg::Type type, const void* data, size_t size)
+    {
+        arg.type = type;
+        arg.offset = record.arena_used;
+        arg.size = static_cast<uint8_t>(std::min(size, LogRecord::arena_size - record.arena_used));
+        std::memcpy(record.arena + arg.offset, data, arg.size);
+        record.arena_used = static_cast<uint8_t>(record.arena_used + arg.size);
+    }
+
+private:
+    mutable std::mutex mutex_;  // buffer and module registration, never taken on the log path
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers_;
+    std::vector<LogModule*> modules_;
+    LogLevel level_{LogLevel::Info};
+    std::atomic<uint32_t> next_thread_id_{0};
+    std::atomic<uint64_t> retired_drops_{0};
+
+    std::condition_variable cv_;
+    uint64_t flush_requested_{0};
+    uint64_t flush_done_{0};
+    bool running_{true};
+    std::thread writer_;
+};
+
+#define LOG_AT(module, level, format, ...) \
+    do { \
+        if ((module).enabled(level)) \
+            Logger::instance().log((module), (level), format __VA_OPT__(,) __VA_ARGS__); \
+    } while (0)
+
+#define LOG_TRACE(module, format, ...) LOG_AT(module, LogLevel::Trace, format __VA_OPT__(,) __VA_ARGS__)
+#define LOG_DEBUG(module, format, ...) LOG_AT(module, LogLevel::Debug, format __VA_OPT__(,) __VA_ARGS__)
+#define LOG_INFO(module, format, ...) LOG_AT(module, LogLevel::Info, format __VA_OPT__(,) __VA_ARGS__)
+#define LOG_WARN(module, format, ...) LOG_AT(module, LogLevel::Warn, format __VA_OPT__(,) __VA_ARGS__)
+#define LOG_ERROR(module, format, ...) LOG_AT(module, LogLevel::Error, format __VA_OPT__(,) __VA_ARGS__)
@@ -0,0 +1,244 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+
+#include "metrics/metrics.h"
+
+#include <cmath>
+#include <cstdio>
+#include <stdexcept>
+
+
+namespace {
+    constexpr std::array<std::pair<double, const char*>, 4> exported_quantiles{{
+        {0.5, "0.5"}, {0.9, "0.9"}, {0.99, "0.99"}, {0.999, "0.999"},
+    }};
+
+    void append_labels(std::string& out, const MetricLabels& labels, const char* extra_name = nullptr, const char* extra_value = nullptr)
+    {
+        if (labels.empty() && !extra_name) {
+            return;
+        }
+        out.push_back('{');
+        bool first = true;
+        auto append = [&](const std::string_view name, const std::string_view value) {
+            if (!first) {
+                out.push_back(',');
+            }
+            first = false;
+            out.append(name);
+            out.append("=\"");
+            for (char c : value) {
+                if (c == '\\' || c == '"') {
+                    out.push_back('\\');
+                    out.push_back(c);
+                } else if (c == '\n') {
+                    out.append("\\n");
+                } else {
+                    out.push_back(c);
+                }
+            }
+            out.push_back('"');
+        };
+        for (const auto& [name, value] : labels) {
+            append(name, value);
+        }
+        if (extra_name) {
+            append(extra_name, extra_value);
+        }
+        out.push_back('}');
+    }
+
+    void append_number(std::string& out, double value)
+    {
+        char buf[32];
+        int n = std::snprintf(buf, sizeof(buf), "%.9g", value);
+        out.append(buf, static_cast<size_t>(n));
+    }
+}
+
+uint64_t Histogram::quantile(double q) const
+{
+    const uint64_t total = count();
+    if (total == 0) {
+        return 0;
+    }
+
+    const uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(q * static_cast<double>(total))));
+    uint64_t seen = 0;
+    for (size_t i = 0; i < bucket_count; ++i) {
+        seen += buckets_[i].load(std::memory_order_relaxed);
+        if (seen >= rank) {
+            return std::min(bucket_value(i), max());
+        }
+    }
+    return max();
+}
+
+MetricsRegistry& MetricsRegistry::instance()
+{
+    // Never destroyed: metrics are still touched while static objects are torn down at exit
+    static MetricsRegistry* registry = new MetricsRegistry();
+    return *registry;
+}
+
+MetricsRegistry::Series& MetricsRegistry::series(const std::string& name, const std::string& help, const MetricLabels& labels, Type type)
+{
+    auto [it, inserted] = families_.try_emplace(name);
+    Family& family = it->second;
+    if (inserted) {
+        family.type = type;
+        family.help = help;
+    } else if (family.type != type) {
+        throw std::invalid_argument("metric " + name + " registered with a different type");
+    }
+
+    for (auto& s : family.series) {
+        if (s->labels == labels) {
+            return *s;
+        }
+    }
+
+    auto s = std::make_unique<Series>();
+    s->labels = labels;
+    family.series.push_back(std::move(s));
+    return *family.series.back();
+}
+
+Counter& MetricsRegistry::counter(const std::string& name, const std::string& help, const MetricLabels& labels)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& s = series(name, help, labels, Type::Counter);
+    if (!s.counter) {
+        s.counter = std::make_unique<Counter>();
+    }
+    return *s.counter;
+}
+
+Gauge& MetricsRegistry::gauge(const std::string& name, const std::string& help, const MetricLabels& labels)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& s = series(name, help, labels, Type::Gauge);
+    if (!s.gauge) {
+        s.gauge = std::make_unique<Gauge>();
+    }
+    return *s.gauge;
+}
+
+Histogram& MetricsRegistry::histogram(const std::string& name, const std::string& help, const MetricLabels& labels, double scale)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& s = series(name, help, labels, Type::Histogram);
+    if (!s.histogram) {
+        s.histogram = std::make_unique<Histogram>(scale);
+    }
+    return *s.histogram;
+}
+
+std::string MetricsRegistry::render_prometheus() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::string out;
+    out.reserve(4096);
+
+    for (const auto& [name, family] : families_) {
+        static constexpr const char* type_names[] = {"counter", "gauge", "summary"};
+        out.append("# HELP ").append(name).append(" ").append(family.help).append("\n");
+        out.append("# TYPE ").append(name).append(" ").append(type_names[static_cast<int>(family.type)]).append("\n");
+
+        for (const auto& s : family.series) {
+            switch (family.type) {
+            case Type::Counter:
+                out.append(name);
+                append_labels(out, s->labels);
+                out.append(" ").append(std::to_string(s->counter->value())).append("\n");
+                break;
+            case Type::Gauge:
+                out.append(name);
+                append_labels(out, s->labels);
+                out.append(" ").append(std::to_string(s->gauge->value())).append("\n");
+                break;
+            case Type::Histogram: {
+                // Exported as a summary: HDR buckets are too many for a Prometheus histogram
+                const Histogram& h = *s->histogram;
+                for (const auto& [q, label] : exported_quantiles) {
+                    out.append(name);
+                    append_labels(out, s->labels, "quantile", label);
+                    out.append(" ");
+                    append_number(out, static_cast<double>(h.quantile(q)) * h.scale());
+                    out.append("\n");
+                }
+                out.append(name).append("_sum");
+                append_labels(out, s->labels);
+                out.append(" ");
+                append_number(out, static_cast<double>(h.sum()) * h.scale());
+                out.append("\n");
+                out.append(name).append("_count");
+                append_labels(out, s->labels);
+                out.append(" ").append(std::to_string(h.count())).append("\n");
+                break;
+            }
+            }
+        }
+    }
+    return out;
+}
+
+nlohmann::json MetricsRegistry::snapshot() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto metrics = nlohmann::json::array();
+
+    for (const auto& [name, family] : families_) {
+        for (const auto& s : family.series) {
+            nlohmann::json item;
+            item["name"] = name;
+            auto labels = nlohmann::json::object();
+            for (const auto& [key, value] : s->labels) {
+                labels[key] = value;
+            }
+            item["labels"] = std::move(labels);
+
+            switch (family.type) {
+            case Type::Counter:
+                item["value"] = s->counter->value();
+                break;
+            case Type::Gauge:
+                item["value"] = s->gauge->value();
+                break;
+            case Type::Histogram: {
+                const Histogram& h = *s->histogram;
+                item["count"] = h.count();
+                item["sum"] = static_cast<double>(h.sum()) * h.scale();
+                item["max"] = static_cast<double>(h.max()) * h.scale();
+                item["p50"] = static_cast<double>(h.quantile(0.5)) * h.scale();
+                item["p90"] = static_cast<double>(h.quantile(0.9)) * h.scale();
+                item["p99"] = static_cast<double>(h.quantile(0.99)) * h.scale();
+                item["p999"] = static_cast<double>(h.quantile(0.999)) * h.scale();
+                break;
+            }
+            }
+            metrics.push_back(std::move(item));
+        }
+    }
+    return {{"metrics", std::move(metrics)}};
+}
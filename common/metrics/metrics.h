@@ -0,0 +1,170 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+
+using MetricLabels = std::vector<std::pair<std::string, std::string>>;
+
+// Monotonic count, one relaxed atomic add per update
+class Counter
+{
+public:
+    void add(uint64_t n = 1) { value_.fetch_add(n, std::memory_order_relaxed); }
+    uint64_t value() const { return value_.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<uint64_t> value_{0};
+};
+
+class Gauge
+{
+public:
+    void set(int64_t v) { value_.store(v, std::memory_order_relaxed); }
+    void add(int64_t n) { value_.fetch_add(n, std::memory_order_relaxed); }
+    int64_t value() const { return value_.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<int64_t> value_{0};
+};
+
+// HDR-style log-linear histogram over non-negative integers: every power of two is split
+// into 16 linear sub-buckets, so any recorded value is known to within ~6% across the
+// whole 64-bit range. Recording is lock free and allocation free.
+class Histogram
+{
+public:
+    static constexpr unsigned sub_bucket_bits = 4;
+    static constexpr size_t sub_buckets = size_t{1} << sub_bucket_bits;
+    static constexpr size_t bucket_count = (64 - sub_bucket_bits + 1) * sub_buckets;
+
+    // `scale` converts recorded units to exported units, e.g. 1e-6 for microseconds to seconds
+    explicit Histogram(double scale = 1.0)
+        : scale_(scale)
+    {
+    }
+
+    void record(uint64_t value)
+    {
+        buckets_[bucket_index(value)].fetch_add(1, std::memory_order_relaxed);
+        count_.fetch_add(1, std::memory_order_relaxed);
+        sum_.fetch_add(value, std::memory_order_relaxed);
+
+        uint64_t max = max_.load(std::memory_order_relaxed);
+        while (value > max && !max_.compare_exchange_weak(max, value, std::memory_order_relaxed)) {
+        }
+    }
+
+    uint64_t count() const { return count_.load(std::memory_order_relaxed); }
+    uint64_t sum() const { return sum_.load(std::memory_order_relaxed); }
+    uint64_t max() const { return max_.load(std::memory_order_relaxed); }
+    double scale() const { return scale_; }
+
+    // Value at quantile q in [0, 1], in recorded units
+    uint64_t quantile(double q) const;
+
+    static constexpr size_t bucket_index(uint64_t value)
+    {
+        if (value < sub_buckets) {
+            return static_cast<size_t>(value);
+        }
+        const unsigned exponent = static_cast<unsigned>(std::bit_width(value)) - 1 - sub_bucket_bits;
+        return exponent * sub_buckets + static_cast<size_t>(value >> exponent);
+    }
+
+    // Midpoint of the values that map to `index`
+    static constexpr uint64_t bucket_value(size_t index)
+    {
+        if (index < 2 * sub_buckets) {
+            return index;
+        }
+        const unsigned exponent = static_cast<unsigned>(index / sub_buckets) - 1;
+        const uint64_t mantissa = index % sub_buckets + sub_buckets;
+        return (mantissa << exponent) + ((uint64_t{1} << exponent) >> 1);
+    }
+
+private:
+    double scale_;
+    std::array<std::atomic<uint64_t>, bucket_count> buckets_{};
+    std::atomic<uint64_t> count_{0};
+    std::atomic<uint64_t> sum_{0};
+    std::atomic<uint64_t> max_{0};
+};
+
+// Process wide set of named metrics. Registration takes a lock and returns a reference that
+// stays valid for the lifetime of the process; hot paths keep the reference and never look
+// metrics up by name. Asking for an existing name and label set returns the same metric.
+class MetricsRegistry
+{
+public:
+    static MetricsRegistry& instance();
+
+    Counter& counter(const std::string& name, const std::string& help, const MetricLabels& labels = {});
+    Gauge& gauge(const std::string& name, const std::string& help, const MetricLabels& labels = {});
+    Histogram& histogram(const std::string& name, const std::string& help, const MetricLabels& labels = {}, double scale = 1.0);
+
+    // Prometheus text exposition format
+    std::string render_prometheus() const;
+
+    // {"metrics": [{"name": ..., "labels": {...}, "value": ...}, ...]}, histograms carry
+    // count, sum, max and p50/p90/p99/p999 instead of a value
+    nlohmann::json snapshot() const;
+
+private:
+    enum class Type { Counter, Gauge, Histogram };
+
+    struct Series {
+        MetricLabels labels;
+        std::unique_ptr<Counter> counter;
+        std::unique_ptr<Gauge> gauge;
+        std::unique_ptr<Histogram> histogram;
+    };
+
+    struct Family {
+        Type type;
+        std::string help;
+        std::vector<std::unique_ptr<Series>> series;
+    };
+
+    MetricsRegistry() = default;
+
+    Series& series(const std::string& name, const std::string& help, const MetricLabels& labels, Type type);
+
+private:
+    mutable std::mutex mutex_;
+    std::map<std::string, Family> families_;
+};
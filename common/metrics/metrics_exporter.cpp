@@ -0,0 +1,207 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+
+#include "metrics/metrics_exporter.h"
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "logging/logger.h"
+
+
+static LogModule log_module("metrics");
+
+namespace {
+    constexpr auto poll_slice = std::chrono::milliseconds(100);
+}
+
+MetricsExporter::Options MetricsExporter::parse_options(const nlohmann::json& config)
+{
+    Options options;
+    options.interval = std::chrono::milliseconds(config.value("interval_ms", options.interval.count()));
+    options.file = config.value("file", std::string{});
+    options.socket = config.value("socket", std::string{});
+    options.mqtt_topic = config.value("mqtt_topic", std::string{});
+    if (options.interval.count() <= 0) {
+        options.interval = std::chrono::milliseconds(1000);
+    }
+    return options;
+}
+
+MetricsExporter::MetricsExporter(MetricsRegistry& registry, Options options, Publish publish)
+    : registry_(registry)
+    , options_(std::move(options))
+    , publish_(std::move(publish))
+{
+}
+
+MetricsExporter::~MetricsExporter()
+{
+    stop();
+}
+
+bool MetricsExporter::start()
+{
+    if (running_.exchange(true)) {
+        return false;
+    }
+
+    if (!options_.socket.empty() && !open_socket()) {
+        running_.store(false);
+        return false;
+    }
+
+    thread_ = std::thread(&MetricsExporter::run, this);
+    LOG_INFO(log_module, "Exporting metrics every {} ms", options_.interval.count());
+    return true;
+}
+
+void MetricsExporter::stop()
+{
+    if (!running_.exchange(false)) {
+        return;
+    }
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+
+    // Last snapshot so the file reflects the final counters
+    export_all();
+
+    if (listen_fd_ >= 0) {
+        ::close(listen_fd_);
+        listen_fd_ = -1;
+        ::unlink(options_.socket.c_str());
+    }
+}
+
+bool MetricsExporter::open_socket()
+{
+    sockaddr_un addr{};
+    if (options_.socket.size() >= sizeof(addr.sun_path)) {
+        LOG_ERROR(log_module, "Metrics socket path too long: {}", options_.socket);
+        return false;
+    }
+
+    listen_fd_ = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC | SOCK_NONBLOCK, 0);
+    if (listen_fd_ < 0) {
+        LOG_ERROR(log_module, "Metrics socket failed: {}", std::strerror(errno));
+        return false;
+    }
+
+    addr.sun_family = AF_UNIX;
+    std::strncpy(addr.sun_path, options_.socket.c_str(), sizeof(addr.sun_path) - 1);
+    ::unlink(options_.socket.c_str());  // stale socket of a previous run
+
+    if (::bind(listen_fd_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0 || ::listen(listen_fd_, 4) < 0) {
+        LOG_ERROR(log_module, "Metrics socket {} failed: {}", options_.socket, std::strerror(errno));
+        ::close(listen_fd_);
+        listen_fd_ = -1;
+        return false;
+    }
+    return true;
+}
+
+void MetricsExporter::run()
+{
+    auto next_export = std::chrono::steady_clock::now() + options_.interval;
+
+    while (running_.load()) {
+        const auto now = std::chrono::steady_clock::now();
+        if (now >= next_export) {
+            export_all();
+            next_export = now + options_.interval;
+        }
+
+        const auto wait = std::min(poll_slice, std::chrono::duration_cast<std::chrono::milliseconds>(next_export - now));
+        if (listen_fd_ < 0) {
+            std::this_thread::sleep_for(wait);
+            continue;
+        }
+
+        pollfd pfd{listen_fd_, POLLIN, 0};
+        if (::poll(&pfd, 1, static_cast<int>(wait.count())) > 0 && (pfd.revents & POLLIN)) {
+            serve_client();
+        }
+    }
+}
+
+void MetricsExporter::serve_client()
+{
+    int client = ::accept4(listen_fd_, nullptr, nullptr, SOCK_CLOEXEC);
+    if (client < 0) {
+        return;
+    }
+
+    // A client that does not read must not stall the exporter
+    timeval timeout{1, 0};
+    setsockopt(client, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+
+    const std::string text = registry_.render_prometheus();
+    size_t written = 0;
+    while (written < text.size()) {
+        ssize_t n = ::send(client, text.data() + written, text.size() - written, MSG_NOSIGNAL);
+        if (n <= 0) {
+            break;
+        }
+        written += static_cast<size_t>(n);
+    }
+    ::close(client);
+}
+
+void MetricsExporter::export_all()
+{
+    if (!options_.file.empty()) {
+        write_file(registry_.render_prometheus());
+    }
+
+    if (!options_.mqtt_topic.empty() && publish_) {
+        auto snapshot = registry_.snapshot();
+        snapshot["timestamp_ms"] = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+        publish_(options_.mqtt_topic, snapshot.dump());
+    }
+}
+
+void MetricsExporter::write_file(const std::string& text)
+{
+    // Readers never see a half written file
+    const std::string tmp = options_.file + ".tmp";
+    {
+        std::ofstream out(tmp, std::ios::trunc);
+        if (!out || !(out << text)) {
+            LOG_WARN(log_module, "Failed to write metrics file {}", tmp);
+            return;
+        }
+    }
+    if (std::rename(tmp.c_str(), options_.file.c_str()) != 0) {
+        LOG_WARN(log_module, "Failed to replace metrics file {}: {}", options_.file, std::strerror(errno));
+    }
+}
@@ -0,0 +1,81 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <string>
+#include <thread>
+
+#include <nlohmann/json.hpp>
+
+#include "metrics/metrics.h"
+
+
+// Periodically writes the registry out: Prometheus text to a file (replaced atomically,
+// e.g. for the node_exporter textfile collector), Prometheus text to every client of a
+// Unix socket, and a JSON snapshot through a publish callback (MQTT in the bridge).
+class MetricsExporter
+{
+public:
+    struct Options {
+        std::chrono::milliseconds interval{10000};
+        std::string file;
+        std::string socket;
+        std::string mqtt_topic;
+
+        bool enabled() const { return !file.empty() || !socket.empty() || !mqtt_topic.empty(); }
+    };
+
+    using Publish = std::function<void(const std::string& topic, const std::string& payload)>;
+
+    // {"interval_ms": 10000, "file": "...", "socket": "...", "mqtt_topic": "..."}
+    static Options parse_options(const nlohmann::json& config);
+
+    MetricsExporter(MetricsRegistry& registry, Options options, Publish publish = {});
+    ~MetricsExporter();
+
+    MetricsExporter(const MetricsExporter&) = delete;
+    MetricsExporter& operator=(const MetricsExporter&) = delete;
+
+    bool start();
+    void stop();
+
+private:
+    void run();
+    bool open_socket();
+    void serve_client();
+    void export_all();
+    void write_file(const std::string& text);
+
+private:
+    MetricsRegistry& registry_;
+    Options options_;
+    Publish publish_;
+
+    int listen_fd_{-1};
+    std::atomic<bool> running_{false};
+    std::thread thread_;
+};
@@ -0,0 +1,222 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+
+#include "scheduling/timer_scheduler.h"
+
+#include <algorithm>
+
+#include "logging/logger.h"
+
+
+static LogModule log_module("scheduler");
+
+TimerScheduler::Options TimerScheduler::parse_options(const nlohmann::json& config)
+{
+    Options options;
+    options.tick = std::chrono::microseconds(config.value("tick_us", options.tick.count()));
+    options.threads = config.value("threads", options.threads);
+    if (options.tick.count() <= 0) {
+        options.tick = std::chrono::microseconds(100);
+    }
+    if (options.threads == 0) {
+        options.threads = 1;
+    }
+    return options;
+}
+
+TimerScheduler::TimerScheduler(Options options)
+    : options_(options)
+    , epoch_(Clock::now())
+    , lateness_(MetricsRegistry::instance().histogram("scheduler_lateness_seconds",
+          "How late periodic tasks started after their deadline", {}, 1e-6))
+    , overruns_(MetricsRegistry::instance().counter("scheduler_overruns_total", "Periodic task runs skipped because the task fell behind"))
+    , tasks_(MetricsRegistry::instance().gauge("scheduler_tasks", "Periodic tasks scheduled"))
+{
+    for (size_t i = 0; i < std::max<size_t>(options_.threads, 1); ++i) {
+        shards_.push_back(std::make_unique<Shard>());
+    }
+}
+
+TimerScheduler::~TimerScheduler()
+{
+    stop();
+}
+
+bool TimerScheduler::start()
+{
+    if (running_.exchange(true)) {
+        return true;
+    }
+
+    for (auto& shard : shards_) {
+        shard->thread = std::thread(&TimerScheduler::run, this, std::ref(*shard));
+    }
+    LOG_INFO(log_module, "Timer scheduler running with {} thread(s), {} us tick", shards_.size(), options_.tick.count());
+    return true;
+}
+
+void TimerScheduler::stop()
+{
+    if (!running_.exchange(false)) {
+        return;
+    }
+
+    for (auto& shard : shards_) {
+        std::lock_guard lock(shard->mutex);
+        shard->wake.notify_one();
+    }
+    for (auto& shard : shards_) {
+        if (shard->thread.joinable()) {
+            shard->thread.join();
+        }
+    }
+
+    if (lateness_.count() > 0) {
+        LOG_INFO(log_module, "Task lateness p50 {} us, p99 {} us, max {} us, {} runs skipped",
+                 lateness_.quantile(0.5), lateness_.quantile(0.99), lateness_.max(), overruns_.value());
+    }
+}
+
+TimerScheduler::TaskId TimerScheduler::schedule(Task task, std::chrono::nanoseconds period, Clock::time_point first)
+{
+    const TaskId id = ++next_id_;
+    Shard& shard = *shards_[id % shards_.size()];
+    {
+        std::lock_guard lock(shard.mutex);
+        shard.timers.emplace(id, Timer{std::move(task), first, std::max(period, std::chrono::nanoseconds(1))});
+        shard.wheel.insert(id, deadline_tick(first));
+        shard.changed = true;
+    }
+    shard.wake.notify_one();
+    tasks_.add(1);
+    return id;
+}
+
+void TimerScheduler::cancel(TaskId id)
+{
+    Shard& shard = *shards_[id % shards_.size()];
+
+    // From inside a task of this shard: the timer is in use, fire() drops it afterwards
+    if (std::this_thread::get_id() == shard.thread_id) {
+        std::lock_guard lock(shard.mutex);
+        auto it = shard.timers.find(id);
+        if (it != shard.timers.end() && !it->second.cancelled) {
+            it->second.cancelled = true;
+            tasks_.add(-1);
+        }
+        return;
+    }
+
+    // Its wheel entry stays behind and is skipped when it expires
+    std::lock_guard run_lock(shard.run_mutex);
+    std::lock_guard lock(shard.mutex);
+    auto it = shard.timers.find(id);
+    if (it != shard.timers.end()) {
+        if (!it->second.cancelled) {
+            tasks_.add(-1);
+        }
+        shard.timers.erase(it);
+    }
+}
+
+void TimerScheduler::run(Shard& shard)
+{
+    std::vector<TaskId> expired;
+    {
+        std::lock_guard lock(shard.mutex);
+        shard.thread_id = std::this_thread::get_id();
+    }
+
+    while (running_.load()) {
+        {
+            // Sleep until the next slot that holds a timer, or until a new one comes in
+            std::unique_lock lock(shard.mutex);
+            const auto wake_at = tick_time(shard.wheel.now() + shard.wheel.idle_ticks());
+            shard.wake.wait_until(lock, wake_at, [&] { return !running_.load() || shard.changed; });
+            shard.changed = false;
+
+            // Catches up on every tick that passed, also after a late wakeup
+            const auto current = static_cast<uint64_t>((Clock::now() - epoch_) / options_.tick);
+            while (shard.wheel.now() < current) {
+                shard.wheel.advance(expired);
+            }
+        }
+
+        std::lock_guard run_lock(shard.run_mutex);
+        for (TaskId id : expired) {
+            fire(shard, id);
+        }
+        expired.clear();
+    }
+}
+
+void TimerScheduler::fire(Shard& shard, TaskId id)
+{
+    // Stable while run_mutex is held: only cancel() erases, and it waits for run_mutex
+    Timer* timer = nullptr;
+    {
+        std::lock_guard lock(shard.mutex);
+        auto it = shard.timers.find(id);
+        if (it == shard.timers.end() || it->second.cancelled) {
+            return;
+        }
+        timer = &it->second;
+    }
+
+    const auto start = Clock::now();
+    const auto late = std::chrono::duration_cast<std::chrono::microseconds>(start - timer->deadline).count();
+    lateness_.record(late > 0 ? static_cast<uint64_t>(late) : 0);
+
+    timer->task();
+
+    std::lock_guard lock(shard.mutex);
+    if (timer->cancelled) {
+        shard.timers.erase(id);
+        return;
+    }
+
+    // Next absolute deadline; runs that are already due again are skipped, not bunched up
+    timer->deadline += timer->period;
+    const auto now = Clock::now();
+    if (timer->deadline <= now) {
+        const auto missed = (now - timer->deadline) / timer->period + 1;
+        timer->deadline += missed * timer->period;
+        overruns_.add(static_cast<uint64_t>(missed));
+    }
+    shard.wheel.insert(id, deadline_tick(timer->deadline));
+}
+
+uint64_t TimerScheduler::deadline_tick(Clock::time_point deadline) const
+{
+    // Rounded up, a task never runs before its deadline
+    if (deadline <= epoch_) {
+        return 0;
+    }
+    const auto tick = std::chrono::duration_cast<std::chrono::nanoseconds>(options_.tick);
+    return static_cast<uint64_t>((deadline - epoch_ + tick - Clock::duration(1)) / tick);
+}
+
+TimerScheduler::Clock::time_point TimerScheduler::tick_time(uint64_t tick) const
+{
+    return epoch_ + options_.tick * tick;
+}
@@ -0,0 +1,113 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "metrics/metrics.h"
+#include "scheduling/timer_wheel.h"
+
+
+// Runs periodic tasks from a few threads, each with its own timer wheel. Deadlines are
+// absolute (first + n * period), so a late run does not push the following ones back; a task
+// that falls more than a period behind skips the missed runs. Every run records how late it
+// started in the scheduler_lateness_seconds histogram.
+class TimerScheduler
+{
+public:
+    using Clock = std::chrono::steady_clock;
+    using Task = std::function<void()>;
+    using TaskId = uint64_t;
+
+    struct Options {
+        std::chrono::microseconds tick{100};    // wheel resolution, deadlines round up to it
+        size_t threads{1};
+    };
+
+    // Reads { "tick_us": 100, "threads": 1 }
+    static Options parse_options(const nlohmann::json& config);
+
+    explicit TimerScheduler(Options options);
+    ~TimerScheduler();
+
+    TimerScheduler(const TimerScheduler&) = delete;
+    TimerScheduler& operator=(const TimerScheduler&) = delete;
+
+    bool start();
+    void stop();
+
+    // A task always runs on the same thread, so it never overlaps with itself
+    TaskId schedule(Task task, std::chrono::nanoseconds period, Clock::time_point first = Clock::now());
+
+    // Once this returns the task is not running and will not run again. Also safe from inside
+    // the task itself.
+    void cancel(TaskId id);
+
+    size_t thread_count() const { return shards_.size(); }
+
+private:
+    struct Timer {
+        Task task;
+        Clock::time_point deadline;
+        std::chrono::nanoseconds period;
+        bool cancelled{false};
+    };
+
+    struct Shard {
+        std::thread thread;
+        std::thread::id thread_id;
+        std::mutex mutex;               // wheel and timers
+        std::condition_variable wake;
+        bool changed{false};            // a new timer may expire before the current sleep ends
+        std::mutex run_mutex;           // held while tasks run, cancel() waits for it
+        TimerWheel wheel;
+        std::unordered_map<TaskId, Timer> timers;
+    };
+
+    void run(Shard& shard);
+    void fire(Shard& shard, TaskId id);
+    uint64_t deadline_tick(Clock::time_point deadline) const;
+    Clock::time_point tick_time(uint64_t tick) const;
+
+private:
+    Options options_;
+    Clock::time_point epoch_;
+    std::vector<std::unique_ptr<Shard>> shards_;
+    std::atomic<bool> running_{false};
+    std::atomic<TaskId> next_id_{0};
+    Histogram& lateness_;
+    Counter& overruns_;
+    Gauge& tasks_;
+};
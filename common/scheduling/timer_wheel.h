@@ -0,0 +1,126 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+// Hierarchical timing wheel over absolute ticks. Level 0 has one slot per tick, every further
+// level covers 256 times the span of the one below; its slots are moved down ("cascaded")
+// when time reaches them. Insert is O(1), advancing one tick is O(1) amortized.
+// Not thread safe, TimerScheduler owns one per thread.
+class TimerWheel
+{
+public:
+    static constexpr unsigned level_bits = 8;
+    static constexpr size_t slots = size_t{1} << level_bits;
+    static constexpr unsigned levels = 4;
+    static constexpr uint64_t slot_mask = slots - 1;
+
+    explicit TimerWheel(uint64_t now = 0)
+        : now_(now)
+    {
+    }
+
+    uint64_t now() const { return now_; }
+    size_t size() const { return size_; }
+
+    // `expires` at or before now() fires on the next advance()
+    void insert(uint64_t id, uint64_t expires)
+    {
+        place({id, expires > now_ ? expires : now_ + 1});
+        ++size_;
+    }
+
+    // Moves time forward by one tick and appends the ids expiring on it
+    void advance(std::vector<uint64_t>& expired)
+    {
+        ++now_;
+
+        // Highest level first, its entries may land in the lower slots cascaded right after
+        for (unsigned level = levels - 1; level > 0; --level) {
+            const unsigned shift = level * level_bits;
+            if ((now_ & ((uint64_t{1} << shift) - 1)) == 0) {
+                cascade(wheel_[level][(now_ >> shift) & slot_mask]);
+            }
+        }
+
+        auto& slot = wheel_[0][now_ & slot_mask];
+        for (const auto& entry : slot) {
+            expired.push_back(entry.id);
+        }
+        size_ -= slot.size();
+        slot.clear();
+    }
+
+    // Ticks that can pass before the next advance() may expire something, at least 1.
+    // Stops at the next level 0 wrap, where higher levels cascade.
+    uint64_t idle_ticks() const
+    {
+        const uint64_t until_wrap = slots - (now_ & slot_mask);
+        for (uint64_t ticks = 1; ticks < until_wrap; ++ticks) {
+            if (!wheel_[0][(now_ + ticks) & slot_mask].empty()) {
+                return ticks;
+            }
+        }
+        return until_wrap;
+    }
+
+private:
+    struct Entry {
+        uint64_t id;
+        uint64_t expires;
+    };
+
+    void place(const Entry& entry)
+    {
+        const uint64_t delta = entry.expires - now_;
+        unsigned level = 0;
+        while (level + 1 < levels && delta >= (uint64_t{1} << ((level + 1) * level_bits))) {
+            ++level;
+        }
+
+        // Beyond the top level's span: park at its far end, the next cascade re-places it
+        const uint64_t horizon = now_ + (uint64_t{1} << (levels * level_bits)) - 1;
+        const uint64_t at = entry.expires < horizon ? entry.expires : horizon;
+        wheel_[level][(at >> (level * level_bits)) & slot_mask].push_back(entry);
+    }
+
+    void cascade(std::vector<Entry>& slot)
+    {
+        std::vector<Entry> entries;
+        entries.swap(slot);
+        for (const auto& entry : entries) {
+            place(entry);
+        }
+    }
+
+private:
+    uint64_t now_;
+    size_t size_{0};
+    std::array<std::array<std::vector<Entry>, slots>, levels> wheel_;
+};
@@ -23,18 +23,24 @@
 
 #include "sensor_data_source.h"
 
-#include <iostream>
 #include <limits>
 #include <cstdlib>
 #include <cstring>
 
 
 #include "sensors/sensors_data.h"
+#include "logging/logger.h"
 
-SensorDataSource::SensorDataSource(std::string name) : name_(std::move(name)) {}
+static LogModule log_module("sensors");
+
+SensorDataSource::SensorDataSource(std::string name, std::shared_ptr<TimerScheduler> scheduler, std::chrono::microseconds period)
+    : scheduler_(std::move(scheduler))
+    , period_(period)
+    , name_(std::move(name)) {}
 
 SensorDataSource::~SensorDataSource() {
     stop();
+    wait();
 }
 
 void SensorDataSource::register_callback(DataCallback<SensorData> callback) {
@@ -47,19 +53,17 @@ bool SensorDataSource::start() {
         return false;
     }
 
-    try {
-        worker_thread_ = std::make_unique<std::thread>(&SensorDataSource::thread_worker, this);
-        std::cout << "Data source thread started" << std::endl;
-        return true;
-    } catch (const std::exception& e) {
-        std::cerr << "Failed to start data source thread: " << e.what() << std::endl;
-        running_.store(false);
-        return false;
-    }
+    // First reading right away, then on absolute deadlines so the period does not drift
+    const auto period = period_.count() > 0 ? period_ : get_sensor_response_time();
+    task_ = scheduler_->schedule([this]() { emit_reading(); }, period);
+    LOG_INFO(log_module, "Data source started: {} every {} us", name_, period.count());
+    return true;
 }
 
 void SensorDataSource::stop() {
-    running_.exchange(false);
+    // Called from signal handlers: only flag and wake, wait() cancels the task
+    running_.store(false);
+    running_.notify_all();
 }
 
 bool SensorDataSource::is_running() const {
@@ -67,29 +71,27 @@ bool SensorDataSource::is_running() const {
 }
 
 void SensorDataSource::wait() {
-    if (worker_thread_ && worker_thread_->joinable()) {
-        worker_thread_->join();
+    running_.wait(true);
+    if (task_ != 0) {
+        scheduler_->cancel(task_);
+        task_ = 0;
+        LOG_DEBUG(log_module, "{}: stopped", name_);
     }
 }
 
 
-void SensorDataSource::thread_worker() {
-    std::cout << "Worker thread started (ID: " << std::this_thread::get_id() << ")" << std::endl;
-
-    while (running_.load()) {
-        {
-            std::lock_guard<std::mutex> cb_lock(callback_mutex_);
-            if (data_callback_) {
-                SensorData data;
-                data.sensor_id = static_cast<uint8_t>(get_sensor_id());
-                data.value = get_sensor_value();
-                data_callback_(data);
-            }
-        }
-        std::this_thread::sleep_for(get_sensor_response_time());
+void SensorDataSource::emit_reading() {
+    if (!running_.load(std::memory_order_relaxed)) {
+        return;
     }
 
-    std::cout << "Worker thread exiting (ID: " << std::this_thread::get_id() << ")" << std::endl;
+    std::lock_guard<std::mutex> cb_lock(callback_mutex_);
+    if (data_callback_) {
+        SensorData data;
+        data.sensor_id = static_cast<uint8_t>(get_sensor_id());
+        data.value = get_sensor_value();
+        data_callback_(data);
+    }
 }
 
 SensorId SensorDataSource::get_sensor_id() const {
@@ -120,7 +122,7 @@ float SensorDataSource::get_sensor_value() const {
     }
 }
 
-std::chrono::seconds SensorDataSource::get_sensor_response_time() const {
+std::chrono::microseconds SensorDataSource::get_sensor_response_time() const {
     if (name_ == "temperature_sensor1") {
         return std::chrono::seconds(3);
     } else if (name_ == "temperature_sensor2") {
@@ -23,7 +23,6 @@
 
 #pragma once
 
-#include <thread>
 #include <mutex>
 #include <atomic>
 #include <memory>
@@ -31,11 +30,15 @@
 
 #include "sensors/idata_source.h"
 #include "sensors/sensors_data.h"
+#include "scheduling/timer_scheduler.h"
 
 
+// Emulated sensor, read periodically on a shared TimerScheduler instead of a thread of its own
 class SensorDataSource : public IDataSource<SensorData> {
 public:
-    SensorDataSource(std::string name);
+    // A zero `period` uses the sensor's default response time
+    SensorDataSource(std::string name, std::shared_ptr<TimerScheduler> scheduler,
+                     std::chrono::microseconds period = std::chrono::microseconds(0));
     ~SensorDataSource() override;
 
     void register_callback(DataCallback<SensorData> callback) override;
@@ -53,13 +56,15 @@ public:
     }
 
 protected:
-    void thread_worker();
+    void emit_reading();
     SensorId get_sensor_id() const;
     float get_sensor_value() const;
-    std::chrono::seconds get_sensor_response_time() const;
+    std::chrono::microseconds get_sensor_response_time() const;
 
 private:
-    std::unique_ptr<std::thread> worker_thread_;
+    std::shared_ptr<TimerScheduler> scheduler_;
+    std::chrono::microseconds period_;
+    TimerScheduler::TaskId task_{0};
     std::atomic<bool> running_{false};
     std::mutex callback_mutex_;
     DataCallback<SensorData> data_callback_;
@@ -25,6 +25,7 @@
 
 
 #include <cstdint>
+#include <cstring>
 #include <string>
 
 
@@ -41,6 +42,70 @@ struct SensorData {
     float value;
 };
 
+// Wire layout of one reading inside a CAN payload: 1 byte sensor_id, 4 bytes float value.
+// FD frames carry several records back to back, a zero sensor_id (padding) ends the list.
+constexpr size_t sensor_data_wire_size = sizeof(SensorData::sensor_id) + sizeof(SensorData::value);
+
+inline void encode_sensor_data(const SensorData& data, uint8_t* out) {
+    std::memcpy(out, &data.sensor_id, sizeof(data.sensor_id));
+    std::memcpy(out + sizeof(data.sensor_id), &data.value, sizeof(data.value));
+}
+
+inline SensorData decode_sensor_data(const uint8_t* in) {
+    SensorData data;
+    std::memcpy(&data.sensor_id, in, sizeof(data.sensor_id));
+    std::memcpy(&data.value, in + sizeof(data.sensor_id), sizeof(data.value));
+    return data;
+}
+
+// Latency trace record, sent by the producer on its own CAN ID and consumed by the bridge.
+// 8 bytes so it fits a classic frame: 0xFF marker, 16-bit sequence number (little endian) and
+// the lower 40 bits of the send time in µs since Unix epoch (little endian, wraps every ~12 days).
+constexpr uint8_t trace_record_marker = 0xFF;
+constexpr size_t trace_record_wire_size = 8;
+constexpr unsigned trace_time_bits = 40;
+
+struct TraceRecord {
+    uint16_t seq;
+    uint64_t send_us;
+};
+
+inline void encode_trace_record(const TraceRecord& record, uint8_t* out) {
+    out[0] = trace_record_marker;
+    out[1] = static_cast<uint8_t>(record.seq);
+    out[2] = static_cast<uint8_t>(record.seq >> 8);
+    for (unsigned i = 0; i < trace_time_bits / 8; ++i) {
+        out[3 + i] = static_cast<uint8_t>(record.send_us >> (8 * i));
+    }
+}
+
+inline bool is_trace_record(const uint8_t* in, size_t len) {
+    return len >= trace_record_wire_size && in[0] == trace_record_marker;
+}
+
+// `now_us` restores the upper bits of the send time, it must be within ~6 days of it
+inline TraceRecord decode_trace_record(const uint8_t* in, uint64_t now_us) {
+    constexpr uint64_t span = uint64_t{1} << trace_time_bits;
+
+    TraceRecord record;
+    record.seq = static_cast<uint16_t>(in[1] | (in[2] << 8));
+
+    uint64_t low = 0;
+    for (unsigned i = 0; i < trace_time_bits / 8; ++i) {
+        low |= static_cast<uint64_t>(in[3 + i]) << (8 * i);
+    }
+
+    // Closest value to now with the same lower bits
+    uint64_t send_us = (now_us & ~(span - 1)) | low;
+    if (send_us > now_us && send_us - now_us > span / 2) {
+        send_us -= span;
+    } else if (send_us < now_us && now_us - send_us > span / 2) {
+        send_us += span;
+    }
+    record.send_us = send_us;
+    return record;
+}
+
 
 std::string sensor_id_to_string(SensorId id);
 
@@ -4,9 +4,10 @@ set -euo pipefail
 
 # Install runtime files to /opt/can_mqtt_ipc
 # Copies:
-#  - config.json
+#  - config.json, sensors.dbc
 #  - bridge/build/bridge -> /opt/can_mqtt_ipc/bin/bridge
 #  - producer/build/producer -> /opt/can_mqtt_ipc/bin/producer
+#  - capture/build/cancapture -> /opt/can_mqtt_ipc/capture/cancapture
 #  - presenter/presenter/ -> /opt/can_mqtt_ipc/presenter/
 
 DEST=/opt/can_mqtt_ipc
@@ -22,6 +23,7 @@ fi
 mkdir -p "$DEST/presenter"
 mkdir -p "$DEST/bridge"
 mkdir -p "$DEST/producer"
+mkdir -p "$DEST/capture"
 mkdir -p "$DEST/vcan"
 
 copy_files() {
@@ -31,8 +33,10 @@ copy_files() {
 }
 
 copy_files config.json "$DEST/"
+copy_files sensors.dbc "$DEST/"
 copy_files build/bridge/bridge "$DEST/bridge/"
 copy_files build/producer/producer "$DEST/producer/"
+copy_files build/capture/cancapture "$DEST/capture/"
 copy_files presenter/presenter/main.py "$DEST/presenter/"
 copy_files presenter/pyproject.toml "$DEST/presenter/"
 copy_files presenter/poetry.lock "$DEST/presenter/"
@@ -40,6 +44,7 @@ copy_files presenter/README.md "$DEST/presenter/"
 
 chmod +x "$DEST/bridge/bridge"
 chmod +x "$DEST/producer/producer"
+chmod +x "$DEST/capture/cancapture"
 chmod +x "$DEST/presenter/main.py"
 
 copy_files services/vcan.service /etc/systemd/system/vcan.service
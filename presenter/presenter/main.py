@@ -21,6 +21,7 @@
 
 import json
 import sys
+import struct
 import argparse
 import logging
 import paho.mqtt.client as mqtt
@@ -59,9 +60,57 @@ def on_connect(client, userdata, flags, rc, properties):
     else:
         logger.error(f"Connection failed with code {rc}")
 
+# Packed reading payload published by the bridge (see bridge/payload_serializer.h):
+# version u8, sensor_id u8, value f32, timestamp_us u64, sequence u32, little-endian.
+# The sequence counts per bridge route, so a topic fed by several routes interleaves sequences.
+PACKED_FORMAT = struct.Struct('<BBfQI')
+PACKED_VERSION = 1
+
+# Mirrors SensorId in common/sensors/sensors_data.h
+SENSOR_NAMES = {
+    1: ("temperature_sensor1", "°C"),
+    2: ("temperature_sensor2", "°C"),
+    8: ("speed_sensor1", "km/h"),
+    9: ("speed_sensor2", "km/h"),
+}
+
+def decode_packed(payload):
+    """Decode packed readings into dicts shaped like the JSON payload.
+    Batched messages carry several records back to back."""
+    if not payload or len(payload) % PACKED_FORMAT.size != 0:
+        raise ValueError(f"packed payload must be a multiple of {PACKED_FORMAT.size} bytes, got {len(payload)}")
+    readings = []
+    for version, sensor_id, value, timestamp_us, sequence in PACKED_FORMAT.iter_unpack(payload):
+        if version != PACKED_VERSION:
+            raise ValueError(f"unsupported packed payload version {version}")
+        device, unit = SENSOR_NAMES.get(sensor_id, (f"sensor_{sensor_id}", ""))
+        readings.append({
+            "device": device,
+            "unit": unit,
+            "value": f"{value:.2f}",
+            "timestamp_us": timestamp_us,
+            "sequence": sequence,
+        })
+    return readings
+
 def on_message(client, userdata, msg):
+    # JSON payloads are a text object or, when the bridge batches, an array of objects.
+    # Anything else is the packed binary layout.
+    try:
+        if msg.payload[:1] == b'{':
+            lines = [msg.payload.decode('utf-8', 'ignore')]
+        elif msg.payload[:1] == b'[':
+            readings = json.loads(msg.payload)
+            lines = [json.dumps(r, ensure_ascii=False, separators=(',', ':')) for r in readings]
+        else:
+            lines = [json.dumps(r, ensure_ascii=False) for r in decode_packed(msg.payload)]
+    except ValueError as e:
+        logger.error(f"[{msg.topic}] cannot decode payload: {e}")
+        return
+
     # This logs to both console and file
-    logger.info(f"[{msg.topic}] {msg.payload.decode('utf-8', 'ignore')}")
+    for line in lines:
+        logger.info(f"[{msg.topic}] {line}")
 
 def main():
     parser = argparse.ArgumentParser(description="MQTT Presenter")
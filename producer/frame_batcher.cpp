@@ -0,0 +1,161 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+
+#include "frame_batcher.h"
+
+#include <cstring>
+
+#include "logging/logger.h"
+
+
+static LogModule log_module("producer");
+
+FrameBatcher::FrameBatcher(std::shared_ptr<ICanSender> sender, FlushPolicy policy)
+    : sender_(std::move(sender))
+    , policy_(policy)
+{
+    if (policy_.max_frames == 0) {
+        policy_.max_frames = 1;
+    }
+    pending_.reserve(policy_.max_frames);
+}
+
+FrameBatcher::~FrameBatcher() {
+    stop();
+}
+
+bool FrameBatcher::start() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (running_) {
+        return false;
+    }
+    running_ = true;
+
+    // Immediate mode never leaves frames pending, no need for a timer
+    if (policy_.max_frames > 1) {
+        flusher_ = std::thread(&FrameBatcher::flush_loop, this);
+    }
+    return true;
+}
+
+void FrameBatcher::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_) {
+            return;
+        }
+        running_ = false;
+    }
+    cv_.notify_all();
+
+    if (flusher_.joinable()) {
+        flusher_.join();
+    }
+    flush();
+}
+
+bool FrameBatcher::push(const CanFrame& frame) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    return push_locked(lock, frame);
+}
+
+bool FrameBatcher::append(const CanFrame& header, std::span<const uint8_t> record) {
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    if (header.is_fd) {
+        for (auto it = pending_.rbegin(); it != pending_.rend(); ++it) {
+            if (it->is_fd && it->id == header.id && it->is_extended == header.is_extended) {
+                if (it->len + record.size() > CanFrame::max_data_len) {
+                    break;  // newest frame for this ID is full, start another one
+                }
+                std::memcpy(it->data.data() + it->len, record.data(), record.size());
+                it->len += static_cast<uint8_t>(record.size());
+                return true;
+            }
+        }
+    }
+
+    CanFrame frame = header;
+    frame.set_payload(record);
+    return push_locked(lock, frame);
+}
+
+bool FrameBatcher::push_locked(std::unique_lock<std::mutex>& lock, const CanFrame& frame) {
+    if (pending_.empty()) {
+        oldest_pending_ = std::chrono::steady_clock::now();
+        pending_.push_back(frame);
+        if (pending_.size() < policy_.max_frames) {
+            lock.unlock();
+            cv_.notify_one();  // arm the max_delay timer
+            return true;
+        }
+    } else {
+        pending_.push_back(frame);
+    }
+
+    if (pending_.size() >= policy_.max_frames) {
+        return flush_locked();
+    }
+    return true;
+}
+
+bool FrameBatcher::flush() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return flush_locked();
+}
+
+bool FrameBatcher::flush_locked() {
+    if (pending_.empty()) {
+        return true;
+    }
+
+    size_t sent = sender_->send_batch(pending_);
+    size_t failed = pending_.size() - sent;
+
+    frames_sent_.fetch_add(sent);
+    frames_failed_.fetch_add(failed);
+    pending_.clear();
+
+    if (failed > 0) {
+        LOG_WARN(log_module, "Failed to send {} of {} CAN frames on {}", failed, sent + failed, sender_->name());
+    }
+    return failed == 0;
+}
+
+void FrameBatcher::flush_loop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    while (running_) {
+        if (pending_.empty()) {
+            cv_.wait(lock, [this] { return !running_ || !pending_.empty(); });
+            continue;
+        }
+
+        auto deadline = oldest_pending_ + policy_.max_delay;
+        if (std::chrono::steady_clock::now() >= deadline) {
+            flush_locked();
+        } else {
+            cv_.wait_until(lock, deadline);
+        }
+    }
+}
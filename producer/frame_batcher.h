@@ -0,0 +1,85 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
+#include "can/ican_sender.h"
+
+
+// Queues frames for one CAN interface and hands them to ICanSender::send_batch()
+// once max_frames are pending or the oldest pending frame is max_delay old.
+class FrameBatcher
+{
+public:
+    struct FlushPolicy {
+        size_t max_frames{1};                       // 1 = send every frame immediately
+        std::chrono::microseconds max_delay{0};
+    };
+
+    FrameBatcher(std::shared_ptr<ICanSender> sender, FlushPolicy policy);
+    ~FrameBatcher();
+
+    bool start();
+    void stop();
+
+    // Returns false if a flush triggered by this call failed to send some frames
+    bool push(const CanFrame& frame);
+
+    // Appends `record` to the payload of a pending FD frame with the same ID if it
+    // still fits, otherwise queues a new frame built from `header` and `record`.
+    // Classic frames are never merged.
+    bool append(const CanFrame& header, std::span<const uint8_t> record);
+    bool flush();
+
+    uint64_t frames_sent() const { return frames_sent_.load(); }
+    uint64_t frames_failed() const { return frames_failed_.load(); }
+
+private:
+    bool push_locked(std::unique_lock<std::mutex>& lock, const CanFrame& frame);
+    bool flush_locked();
+    void flush_loop();
+
+private:
+    std::shared_ptr<ICanSender> sender_;
+    FlushPolicy policy_;
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::vector<CanFrame> pending_;
+    std::chrono::steady_clock::time_point oldest_pending_;
+
+    bool running_{false};
+    std::thread flusher_;
+
+    std::atomic<uint64_t> frames_sent_{0};
+    std::atomic<uint64_t> frames_failed_{0};
+};
@@ -0,0 +1,268 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+
+#include "load_generator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+#include <linux/can.h>
+
+#include "sensors/sensors_data.h"
+#include "logging/logger.h"
+
+
+static LogModule log_module("producer");
+
+namespace {
+    using Clock = TimerScheduler::Clock;
+
+    constexpr auto pacing_period = std::chrono::milliseconds(1);
+    constexpr size_t batch_capacity = 64;
+
+    // After a stall at most this much backlog is sent in one go, the rest follows in later periods
+    constexpr double max_catch_up_s = 0.01;
+
+    // Readings cycle through the known sensors so that the bridge routes all of them
+    constexpr SensorId sensor_ids[] = {SensorId::Temperature1, SensorId::Temperature2, SensorId::Speed1, SensorId::Speed2};
+
+    // "vcan0 0x100+16": interface, first ID and number of IDs
+    std::string stream_name(const LoadGenerator::Stream& stream) {
+        char ids[32];
+        std::snprintf(ids, sizeof(ids), " 0x%x+%u", stream.id_base, stream.id_count);
+        return stream.interface + ids;
+    }
+}
+
+LoadGenerator::Options LoadGenerator::parse_options(const nlohmann::json& config) {
+    Options options;
+    if (!config.value("enabled", true)) {
+        return options;
+    }
+
+    options.duration = std::chrono::seconds(config.value("duration_s", int64_t{0}));
+    options.report_interval = std::chrono::milliseconds(config.value("report_interval_ms", options.report_interval.count()));
+    if (options.report_interval.count() <= 0) {
+        options.report_interval = std::chrono::milliseconds(1000);
+    }
+
+    for (const auto& item : config.value("streams", nlohmann::json::array())) {
+        Stream stream;
+        stream.interface = item.value("interface", std::string{});
+        stream.rate = item.value("rate", stream.rate);
+        const auto id_base = item.contains("id_base") ? item["id_base"] : nlohmann::json("0x100");
+        const auto base = id_base.is_string() ? parse_can_id(id_base.get_ref<const std::string&>()) : std::nullopt;
+        stream.id_count = std::max<uint32_t>(item.value("id_count", stream.id_count), 1);
+        if (!base) {
+            LOG_ERROR(log_module, "Invalid load_generator stream, id_base {} is not a CAN ID", id_base.dump());
+            continue;
+        }
+        stream.id_base = *base;
+
+        // Standard streams stay below 0x800, all IDs of a stream share one frame format
+        const uint64_t last_id = uint64_t{stream.id_base} + stream.id_count - 1;
+        if (last_id > (stream.id_base <= can_max_standard_id ? can_max_standard_id : can_max_extended_id)) {
+            LOG_ERROR(log_module, "Invalid load_generator stream, IDs 0x{:X}..0x{:X} leave the {}-bit range",
+                      stream.id_base, last_id, stream.id_base <= can_max_standard_id ? 11 : 29);
+            continue;
+        }
+        stream.fd = item.value("fd", stream.fd);
+        stream.brs = stream.fd && item.value("brs", stream.brs);
+        stream.burst = std::max<size_t>(item.value("burst", stream.burst), 1);
+
+        if (stream.interface.empty() || stream.rate <= 0.0) {
+            LOG_ERROR(log_module, "Invalid load_generator stream, needs an interface and a positive rate");
+            continue;
+        }
+
+        // Classic frames hold up to 8 bytes, FD frames only have a few valid lengths
+        const size_t requested = item.value("payload_bytes", size_t{stream.payload_bytes});
+        stream.payload_bytes = stream.fd ? can_fd_round_up_len(requested) : static_cast<uint8_t>(std::min<size_t>(requested, 8));
+        if (stream.payload_bytes != requested) {
+            LOG_WARN(log_module, "{}: payload of {} bytes sent as {} bytes", stream_name(stream), requested, unsigned{stream.payload_bytes});
+        }
+        options.streams.push_back(std::move(stream));
+    }
+    return options;
+}
+
+LoadGenerator::LoadGenerator(Options options, std::shared_ptr<TimerScheduler> scheduler,
+                             const std::map<std::string, std::shared_ptr<ICanSender>>& senders)
+    : options_(std::move(options))
+    , scheduler_(std::move(scheduler)) {
+    for (const auto& stream : options_.streams) {
+        auto state = std::make_unique<StreamState>();
+        state->stream = stream;
+        auto it = senders.find(stream.interface);
+        if (it != senders.end()) {
+            state->sender = it->second;
+        }
+        state->batch.reserve(std::max(batch_capacity, stream.burst));
+        states_.push_back(std::move(state));
+    }
+}
+
+LoadGenerator::~LoadGenerator() {
+    stop();
+    wait();
+}
+
+bool LoadGenerator::start() {
+    for (const auto& state : states_) {
+        if (!state->sender) {
+            LOG_ERROR(log_module, "{}: interface not in can_interfaces", stream_name(state->stream));
+            return false;
+        }
+    }
+    if (running_.exchange(true)) {
+        return false;
+    }
+
+    started_ = Clock::now();
+    last_report_ = started_;
+    for (const auto& state : states_) {
+        auto* s = state.get();
+        s->task = scheduler_->schedule([this, s]() { pace(*s); }, pacing_period, started_);
+        LOG_INFO(log_module, "Load: {} at {} frames/s, {} byte {} payload{}", stream_name(s->stream), s->stream.rate,
+                 unsigned{s->stream.payload_bytes}, s->stream.fd ? "FD" : "classic",
+                 s->stream.burst > 1 ? ", bursts of " + std::to_string(s->stream.burst) : std::string{});
+    }
+    report_task_ = scheduler_->schedule([this]() { report(false); }, options_.report_interval, started_ + options_.report_interval);
+
+    if (options_.duration.count() > 0) {
+        LOG_INFO(log_module, "Load generation runs for {} s", options_.duration.count());
+    }
+    return true;
+}
+
+void LoadGenerator::stop() {
+    running_.store(false);
+    running_.notify_all();
+}
+
+void LoadGenerator::wait() {
+    running_.wait(true);
+    if (report_task_ == 0) {
+        return;
+    }
+
+    for (const auto& state : states_) {
+        scheduler_->cancel(state->task);
+    }
+    scheduler_->cancel(report_task_);
+    report_task_ = 0;
+    report(true);
+}
+
+void LoadGenerator::pace(StreamState& state) {
+    if (!running_.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    // Frames due since the start at the target rate, capped at the end of the run
+    const auto& stream = state.stream;
+    double elapsed = std::chrono::duration<double>(Clock::now() - started_).count();
+    if (options_.duration.count() > 0) {
+        elapsed = std::min(elapsed, static_cast<double>(options_.duration.count()));
+    }
+    const auto due = static_cast<uint64_t>(stream.rate * elapsed);
+
+    uint64_t owed = due > state.attempted ? due - state.attempted : 0;
+    owed = std::min<uint64_t>(owed, std::max<uint64_t>(stream.burst, static_cast<uint64_t>(std::ceil(stream.rate * max_catch_up_s))));
+    owed -= owed % stream.burst;
+
+    while (owed > 0) {
+        const size_t count = static_cast<size_t>(std::min<uint64_t>(owed, state.batch.capacity()));
+        state.batch.resize(count);
+        for (size_t i = 0; i < count; ++i) {
+            fill(state, state.batch[i], state.attempted + i);
+        }
+
+        const size_t sent = state.sender->send_batch(state.batch);
+        state.attempted += count;
+        owed -= count;
+        state.sent.fetch_add(sent, std::memory_order_relaxed);
+        if (sent < count) {
+            // Typically a full TX queue (ENOBUFS), the frames are lost and counted
+            state.failed.fetch_add(count - sent, std::memory_order_relaxed);
+            break;
+        }
+    }
+}
+
+void LoadGenerator::fill(StreamState& state, CanFrame& frame, uint64_t seq) {
+    const auto& stream = state.stream;
+    frame = CanFrame{};
+    frame.id = stream.id_base + static_cast<uint32_t>(seq % stream.id_count);
+    frame.is_extended = frame.id > CAN_SFF_MASK;
+    frame.is_fd = stream.fd;
+    frame.is_brs = stream.brs;
+    frame.len = stream.payload_bytes;
+
+    if (frame.len < sensor_data_wire_size) {
+        for (size_t i = 0; i < frame.len; ++i) {
+            frame.data[i] = static_cast<uint8_t>(seq >> (8 * i));
+        }
+        return;
+    }
+
+    // Unused tail bytes stay zero, which the bridge reads as padding
+    size_t record = 0;
+    for (size_t offset = 0; offset + sensor_data_wire_size <= frame.len; offset += sensor_data_wire_size, ++record) {
+        SensorData data;
+        data.sensor_id = static_cast<uint8_t>(sensor_ids[(seq + record) % std::size(sensor_ids)]);
+        data.value = static_cast<float>(seq);
+        encode_sensor_data(data, frame.data.data() + offset);
+    }
+}
+
+void LoadGenerator::report(bool final) {
+    const auto now = Clock::now();
+    const auto since = final ? started_ : last_report_;
+    const double seconds = std::max(std::chrono::duration<double>(now - since).count(), 1e-6);
+    last_report_ = now;
+
+    for (const auto& state : states_) {
+        const uint64_t sent = state->sent.load(std::memory_order_relaxed);
+        const uint64_t failed = state->failed.load(std::memory_order_relaxed);
+        const uint64_t interval_sent = final ? sent : sent - state->reported_sent;
+        const uint64_t interval_failed = final ? failed : failed - state->reported_failed;
+        state->reported_sent = sent;
+        state->reported_failed = failed;
+
+        const double achieved = static_cast<double>(interval_sent) / seconds;
+        const double percent = 100.0 * achieved / state->stream.rate;
+        if (final) {
+            LOG_INFO(log_module, "Load total {}: {} frames in {:.2f} s, {:.2f} frames/s of {} ({:.2f}%), {} send failures",
+                     stream_name(state->stream), sent, seconds, achieved, state->stream.rate, percent, failed);
+        } else {
+            LOG_INFO(log_module, "Load {}: {:.2f} frames/s of {} ({:.2f}%), {} send failures",
+                     stream_name(state->stream), achieved, state->stream.rate, percent, interval_failed);
+        }
+    }
+
+    if (!final && options_.duration.count() > 0 && now - started_ >= options_.duration) {
+        stop();
+    }
+}
@@ -0,0 +1,106 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "can/ican_sender.h"
+#include "scheduling/timer_scheduler.h"
+
+
+// Synthetic CAN traffic for stress tests: every stream sends frames at a target rate on one
+// interface, cycling through a range of IDs. Payloads hold SensorData records (value = frame
+// sequence number) so the bridge decodes and publishes them like real readings. Achieved rate
+// and send failures are logged every report interval and once more at the end.
+class LoadGenerator
+{
+public:
+    struct Stream {
+        std::string interface;
+        double rate{1000.0};                // target frames/s
+        uint32_t id_base{0x100};
+        uint32_t id_count{1};               // IDs id_base .. id_base + id_count - 1
+        uint8_t payload_bytes{8};
+        bool fd{false};
+        bool brs{false};
+        size_t burst{1};                    // > 1: frames leave in bursts of this size, same average rate
+    };
+
+    struct Options {
+        std::vector<Stream> streams;
+        std::chrono::seconds duration{0};   // 0 = until stopped
+        std::chrono::milliseconds report_interval{1000};
+
+        bool enabled() const { return !streams.empty(); }
+    };
+
+    // Reads the "producer.load_generator" object, invalid streams are logged and left out.
+    // "enabled": false yields no streams.
+    static Options parse_options(const nlohmann::json& config);
+
+    LoadGenerator(Options options, std::shared_ptr<TimerScheduler> scheduler,
+                  const std::map<std::string, std::shared_ptr<ICanSender>>& senders);
+    ~LoadGenerator();
+
+    bool start();
+
+    // Signal safe, wait() does the cleanup
+    void stop();
+
+    // Returns once the duration has passed or stop() was called
+    void wait();
+
+private:
+    struct StreamState {
+        Stream stream;
+        std::shared_ptr<ICanSender> sender;
+        std::vector<CanFrame> batch;        // touched by the pacing task only
+        uint64_t attempted{0};
+        std::atomic<uint64_t> sent{0};
+        std::atomic<uint64_t> failed{0};
+        uint64_t reported_sent{0};          // report task only
+        uint64_t reported_failed{0};
+        TimerScheduler::TaskId task{0};
+    };
+
+    void pace(StreamState& state);
+    void fill(StreamState& state, CanFrame& frame, uint64_t seq);
+    void report(bool final);
+
+private:
+    Options options_;
+    std::shared_ptr<TimerScheduler> scheduler_;
+    std::vector<std::unique_ptr<StreamState>> states_;
+    std::atomic<bool> running_{false};
+    TimerScheduler::Clock::time_point started_;
+    TimerScheduler::Clock::time_point last_report_;
+    TimerScheduler::TaskId report_task_{0};
+};
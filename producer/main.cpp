@@ -22,9 +22,12 @@
  */
 
 #include <memory>
-#include <iostream>
 
 #include "producer.h"
+#include "logging/logger.h"
+
+
+static LogModule log_module("main");
 
 int main(int argc, char* argv[])
 {
@@ -36,12 +39,12 @@ int main(int argc, char* argv[])
     Producer::set_instance(app);
 
     if (!app->initialize(argc, argv)) {
-        std::cerr << "Failed to initialize the producer" << std::endl;
+        LOG_ERROR(log_module, "Failed to initialize the producer");
         return 1;
     }
 
     if (!app->start()) {
-        std::cerr << "Failed to start the producer" << std::endl;
+        LOG_ERROR(log_module, "Failed to start the producer");
         return 1;
     }
 
@@ -23,15 +23,20 @@
 
 #include "producer.h"
 
-#include <iostream>
 #include <cstdint>
 #include <csignal>
 
 #include "sensors/sensors_data.h"
 #include "can/linux/sockets/can_sender.h"
+#ifdef HAVE_LIBURING
+#include "can/linux/io_uring/can_sender.h"
+#endif
 #include "config/config_parser.h"
+#include "logging/logger.h"
 
 
+static LogModule log_module("producer");
+
 Producer::Producer() {
     signal(SIGTERM, Producer::signal_handler);  // Handle service stop signal
     signal(SIGINT, Producer::signal_handler);   // Handle Ctrl+C in terminal
@@ -40,32 +45,66 @@ Producer::Producer() {
 bool Producer::initialize(int argc, char* argv[]) {
     auto config_opt = load_config(argc, argv);
     if (!config_opt) {
-        std::cerr << "Using default configuration" << std::endl;
+        LOG_ERROR(log_module, "Using default configuration");
         return false;
     }
     config_ = *config_opt;
 
-    if (!config_.contains("can_interfaces") || !config_.contains("producer") || !config_["producer"].contains("data_binding")) {
-        std::cerr << "Invalid config file structure" << std::endl;
+    if (!config_.contains("can_interfaces") || !config_.contains("producer")
+        || !(config_["producer"].contains("data_binding") || config_["producer"].contains("packed_frames")
+             || config_["producer"].contains("load_generator"))) {
+        LOG_ERROR(log_module, "Invalid config file structure");
         return false;
     }
+
+    if (config_["producer"].contains("logging")) {
+        Logger::instance().configure(config_["producer"]["logging"]);
+    }
     return true;
 }
 
 bool Producer::start() {
+    // Optional: "producer": { "load_generator": { ... } } sends synthetic traffic instead of the sensors
+    LoadGenerator::Options load;
+    if (config_["producer"].contains("load_generator")) {
+        load = LoadGenerator::parse_options(config_["producer"]["load_generator"]);
+    }
 
-    if (!setup_data_bindings()) {
-        std::cerr << "Failed to set up data bindings" << std::endl;
+    if (!load.enabled() && !setup_data_bindings()) {
+        LOG_ERROR(log_module, "Failed to set up data bindings");
         return false;
     }
 
     if (!setup_can_senders()) {
-        std::cerr << "Failed to set up CAN senders" << std::endl;
+        LOG_ERROR(log_module, "Failed to set up CAN senders");
+        return false;
+    }
+
+    if (!start_scheduler()) {
+        LOG_ERROR(log_module, "Failed to start the scheduler");
+        return false;
+    }
+
+    if (load.enabled()) {
+        if (!start_load_generator(std::move(load))) {
+            LOG_ERROR(log_module, "Failed to start the load generator");
+            return false;
+        }
+    } else if (!setup_data_sending_callbacks()) {
+        LOG_ERROR(log_module, "Failed to set up data sending callbacks");
+        return false;
+    } else if (!start_signal_packer()) {
+        LOG_ERROR(log_module, "Failed to start packed frames");
         return false;
     }
 
-    if (!setup_data_sending_callbacks()) {
-        std::cerr << "Failed to set up data sending callbacks" << std::endl;
+    if (!start_metrics()) {
+        LOG_ERROR(log_module, "Failed to start metrics export");
+        return false;
+    }
+
+    if (!start_trace()) {
+        LOG_ERROR(log_module, "Failed to start trace frames");
         return false;
     }
 
@@ -75,6 +114,27 @@ bool Producer::start() {
 void Producer::stop() {
     for (auto& data_source : data_sources_) {
         data_source->stop();
+        data_source->wait();
+    }
+    if (load_generator_) {
+        load_generator_->stop();
+        load_generator_->wait();
+    }
+    if (signal_packer_) {
+        signal_packer_->stop();
+    }
+    if (scheduler_) {
+        scheduler_->stop();
+    }
+    trace_running_.store(false);
+    if (trace_thread_.joinable()) {
+        trace_thread_.join();
+    }
+    for (auto& [name, batcher] : tx_batchers_) {
+        batcher->stop();
+    }
+    if (metrics_exporter_) {
+        metrics_exporter_->stop();
     }
 }
 
@@ -82,68 +142,144 @@ void Producer::wait() {
     for (auto& data_source : data_sources_) {
         data_source->wait();
     }
+    if (load_generator_) {
+        load_generator_->wait();
+    }
+    LOG_INFO(log_module, "Data sources stopped, shutting down gracefully...");
+    if (signal_packer_) {
+        signal_packer_->stop();
+    }
+    if (scheduler_) {
+        scheduler_->stop();
+    }
+    trace_running_.store(false);
+    if (trace_thread_.joinable()) {
+        trace_thread_.join();
+    }
+    // Sources are done, push out whatever is still pending
+    for (auto& [name, batcher] : tx_batchers_) {
+        batcher->stop();
+    }
 }
 
 
 bool Producer::setup_data_bindings() {
-    nlohmann::json data_binding = config_["producer"]["data_binding"];
+    nlohmann::json data_binding = config_["producer"].value("data_binding", nlohmann::json::array());
 
     // load data bindings from config
     // maps a data source (e.g. "temperature_sensor") to a CAN interface (e.g. "can0") and message ID (e.g. 0x100)
     for (auto& item : data_binding) {
         DataBinding binding;
         if (!(item.contains("source") && item.contains("destination") && item["destination"].contains("interface") && item["destination"].contains("msg_id"))) {
-            std::cerr << "Invalid data_binding entry in config" << std::endl;
+            LOG_WARN(log_module, "Invalid data_binding entry in config");
             continue;
         }
         binding.data_source = item["source"];
         binding.can_interface = item["destination"]["interface"];
         binding.can_msg_id =  std::stoul(item["destination"]["msg_id"].get<std::string>(), nullptr, 16);
+        binding.fd = item["destination"].value("fd", false);
+        binding.brs = item["destination"].value("brs", false);
+        binding.period = std::chrono::microseconds(item.value("period_us", int64_t{0}));
         bindings_.push_back(binding);
-        std::cout << binding.data_source << " -> " << binding.can_interface << " (0x" << std::hex << binding.can_msg_id << std::dec << ")" << std::endl;
+        LOG_INFO(log_module, "{} -> {} (0x{:x}{})", binding.data_source, binding.can_interface, binding.can_msg_id, binding.fd ? ", FD" : "");
     }
 
-    if (bindings_.empty()) {
-        std::cerr << "No valid data bindings found in config" << std::endl;
+    // Packed frames alone are enough, they bring their own sources
+    if (bindings_.empty() && !config_["producer"].contains("packed_frames")) {
+        LOG_ERROR(log_module, "No valid data bindings found in config");
         return false;
     }
     return true;
 }
 
 bool Producer::setup_can_senders() {
+    auto policy = flush_policy();
+
+    // Optional: "producer": { "can_backend": "io_uring" }, "sockets" by default
+    const std::string backend = config_["producer"].value("can_backend", std::string("sockets"));
+    if (backend != "sockets" && backend != "io_uring") {
+        LOG_ERROR(log_module, "Unknown can_backend: {}", backend);
+        return false;
+    }
+
     // Set up CAN senders for each unique CAN interface in the bindings
     for(const auto& can_interface  : config_["can_interfaces"]) {
-        std::cout << "Setting up CAN interface: " << can_interface << std::endl;
-        can_senders_[can_interface] = std::make_shared<LinuxSocketCanSender>(can_interface);
-        can_senders_[can_interface]->open();
+        LOG_INFO(log_module, "Setting up CAN interface: {}", can_interface.get<std::string>());
+        can_senders_[can_interface] = make_sender(can_interface, backend);
+
+        tx_batchers_[can_interface] = std::make_shared<FrameBatcher>(can_senders_[can_interface], policy);
+        tx_batchers_[can_interface]->start();
     }
     return true;
 }
 
+std::shared_ptr<ICanSender> Producer::make_sender(const std::string& can_interface, const std::string& backend) {
+    if (backend == "io_uring") {
+#ifdef HAVE_LIBURING
+        auto uring = std::make_shared<IoUringCanSender>(can_interface);
+        if (uring->open()) {
+            return uring;
+        }
+        LOG_WARN(log_module, "{}: io_uring send unavailable, using sockets", can_interface);
+#else
+        LOG_WARN(log_module, "{}: built without liburing, using sockets", can_interface);
+#endif
+    }
+
+    auto sender = std::make_shared<LinuxSocketCanSender>(can_interface);
+    sender->open();
+    return sender;
+}
+
+FrameBatcher::FlushPolicy Producer::flush_policy() const {
+    // Optional: "producer": { "tx_batch": { "max_frames": 64, "max_delay_us": 1000 } }
+    FrameBatcher::FlushPolicy policy;
+    if (!config_["producer"].contains("tx_batch")) {
+        return policy;
+    }
+
+    const auto& item = config_["producer"]["tx_batch"];
+    policy.max_frames = item.value("max_frames", policy.max_frames);
+    policy.max_delay = std::chrono::microseconds(item.value("max_delay_us", policy.max_delay.count()));
+    LOG_INFO(log_module, "TX batching: up to {} frames, max delay {} us", policy.max_frames, policy.max_delay.count());
+    return policy;
+}
+
+bool Producer::start_scheduler() {
+    // Sources and load streams share one scheduler. Optional: "producer": { "scheduler": { "threads": 1, "tick_us": 100 } }
+    scheduler_ = std::make_shared<TimerScheduler>(TimerScheduler::parse_options(config_["producer"].value("scheduler", nlohmann::json::object())));
+    return scheduler_->start();
+}
+
 bool Producer::setup_data_sending_callbacks() {
     // Set up data sources and register callbacks to send CAN frames when new data is received
     for (const auto& binding : bindings_) {
-        auto data_source = std::make_shared<SensorDataSource>(binding.data_source);
-        data_source->register_callback([this, binding](const SensorData& data) {
-            std::cout << "Received data from " << binding.data_source << ": Sensor ID=" << static_cast<int>(data.sensor_id) << " Value=" << data.value << std::endl;
-            if (can_senders_.find(binding.can_interface) != can_senders_.end()) {
+        auto* readings = &MetricsRegistry::instance().counter("producer_readings_total", "Sensor readings queued for sending",
+                                                              {{"source", binding.data_source}});
+        auto data_source = std::make_shared<SensorDataSource>(binding.data_source, scheduler_, binding.period);
+        data_source->register_callback([this, binding, readings](const SensorData& data) {
+            LOG_DEBUG(log_module, "Received data from {}: Sensor ID={} Value={}", binding.data_source, data.sensor_id, data.value);
+            if (tx_batchers_.find(binding.can_interface) != tx_batchers_.end()) {
                 CanFrame frame;
                 frame.id = binding.can_msg_id;
                 //frame.is_extended = binding.can_msg_id > CAN_SFF_MASK;   ?????????????????????????????
                 frame.is_rtr = false;
-                // Simple encoding: 1 bytes for sensor_id, 4 bytes for value
-                frame.data.resize(5);
-                std::memcpy(frame.data.data(), &data.sensor_id, sizeof(data.sensor_id));
-                std::memcpy(frame.data.data() + sizeof(data.sensor_id), &data.value, sizeof(data.value));
-                
-                if (!can_senders_[binding.can_interface]->send(frame)) {
-                    std::cerr << "Failed to send CAN frame on " << binding.can_interface << std::endl;
+                frame.is_fd = binding.fd;
+                frame.is_brs = binding.fd && binding.brs;
+
+                // Simple encoding: 1 bytes for sensor_id, 4 bytes for value.
+                // FD bindings sharing a msg_id get their readings packed into one frame per flush.
+                uint8_t record[sensor_data_wire_size];
+                encode_sensor_data(data, record);
+
+                if (!tx_batchers_[binding.can_interface]->append(frame, record)) {
+                    LOG_WARN(log_module, "Failed to send CAN frame on {}", binding.can_interface);
                 } else {
-                    std::cout << "Sent CAN frame on " << binding.can_interface << ": ID=0x" << std::hex << frame.id << std::dec 
-                              << " Data(" << frame.data.size() << " bytes)" << std::endl;
+                    readings->add();
+                    LOG_DEBUG(log_module, "Queued CAN frame on {}: ID=0x{:x} Data({} bytes)", binding.can_interface, frame.id, sensor_data_wire_size);
                 }
             } else {
-                std::cerr << "CAN interface not found for binding: " << binding.can_interface << std::endl;
+                LOG_ERROR(log_module, "CAN interface not found for binding: {}", binding.can_interface);
             }
         });
         data_source->start();
@@ -152,13 +288,127 @@ bool Producer::setup_data_sending_callbacks() {
     return true;
 }
 
+bool Producer::start_signal_packer() {
+    // Optional: "producer": { "packed_frames": { "dbc": "sensors.dbc", "frames": [ ... ] } }
+    if (!config_["producer"].contains("packed_frames")) {
+        return true;
+    }
+
+    auto options = SignalPacker::parse_options(config_["producer"]["packed_frames"]);
+    if (!options.enabled()) {
+        return true;
+    }
+
+    signal_packer_ = std::make_unique<SignalPacker>(std::move(options), scheduler_, tx_batchers_);
+    if (!signal_packer_->start()) {
+        return false;
+    }
+
+    // Every packed signal gets its own sensor, readings only update the value the next frame carries
+    for (const auto& source : signal_packer_->sources()) {
+        auto data_source = std::make_shared<SensorDataSource>(source.name, scheduler_);
+        data_source->register_callback([packer = signal_packer_.get(), source](const SensorData& data) {
+            packer->update(source, data.value);
+        });
+        data_source->start();
+        data_sources_.push_back(std::move(data_source));
+    }
+    return true;
+}
+
+bool Producer::start_load_generator(LoadGenerator::Options options) {
+    // Frames go straight to the senders, the generator batches them itself
+    load_generator_ = std::make_unique<LoadGenerator>(std::move(options), scheduler_, can_senders_);
+    return load_generator_->start();
+}
+
+bool Producer::start_metrics() {
+    // Optional: "metrics": { "interval_ms": 10000, "file": "...", "socket": "..." }
+    if (!config_["producer"].contains("metrics")) {
+        return true;
+    }
+
+    auto options = MetricsExporter::parse_options(config_["producer"]["metrics"]);
+    if (!options.mqtt_topic.empty()) {
+        // The producer talks CAN only, there is no broker connection to publish on
+        LOG_WARN(log_module, "producer.metrics.mqtt_topic ignored, the producer has no MQTT client");
+        options.mqtt_topic.clear();
+    }
+    if (!options.enabled()) {
+        return true;
+    }
+
+    metrics_exporter_ = std::make_unique<MetricsExporter>(MetricsRegistry::instance(), options);
+    return metrics_exporter_->start();
+}
+
+bool Producer::start_trace() {
+    // Optional: "trace": { "interface": "vcan0", "msg_id": "0x7F0", "period_ms": 100, "fd": false }
+    if (!config_["producer"].contains("trace")) {
+        return true;
+    }
+
+    const auto& item = config_["producer"]["trace"];
+    if (!item.contains("interface") || !item.contains("msg_id") || !item["interface"].is_string()) {
+        LOG_ERROR(log_module, "Invalid trace entry in config");
+        return false;
+    }
+    const auto msg_id = item["msg_id"].is_string() ? parse_can_id(item["msg_id"].get_ref<const std::string&>())
+                                                   : std::nullopt;
+    if (!msg_id) {
+        LOG_ERROR(log_module, "Invalid trace msg_id {}", item["msg_id"].dump());
+        return false;
+    }
+
+    const std::string can_interface = item["interface"];
+    auto it = can_senders_.find(can_interface);
+    if (it == can_senders_.end()) {
+        LOG_ERROR(log_module, "CAN interface not found for trace frames: {}", can_interface);
+        return false;
+    }
+
+    CanFrame frame;
+    frame.id = *msg_id;
+    frame.is_extended = frame.id > can_max_standard_id;
+    frame.is_fd = item.value("fd", false);
+    frame.len = static_cast<uint8_t>(trace_record_wire_size);
+    const auto period = std::chrono::milliseconds(item.value("period_ms", 100));
+
+    trace_running_.store(true);
+    trace_thread_ = std::thread(&Producer::trace_worker, this, it->second, frame, period);
+    LOG_INFO(log_module, "Trace frames on {} (0x{:x}) every {} ms", can_interface, frame.id, period.count());
+    return true;
+}
+
+void Producer::trace_worker(std::shared_ptr<ICanSender> sender, CanFrame frame, std::chrono::milliseconds period) {
+    // Trace frames bypass the TX batcher: the timestamp is taken right before the write
+    uint16_t seq = 0;
+    auto next = std::chrono::steady_clock::now();
+    while (trace_running_.load()) {
+        TraceRecord record;
+        record.seq = seq++;
+        record.send_us = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+        encode_trace_record(record, frame.data.data());
+
+        if (!sender->send(frame)) {
+            LOG_DEBUG(log_module, "Failed to send trace frame {} on {}", record.seq, sender->name());
+        }
+
+        next += period;
+        std::this_thread::sleep_until(next);
+    }
+}
+
 void Producer::signal_handler(int signum) {
     if (signum == SIGTERM || signum == SIGINT) {
-        std::cout << "Received stop signal (SIGTERM or SIGINT). Shutting down gracefully..." << std::endl;
         if (instance_) {
             for(const auto& data_source : instance_->data_sources_) {
                 data_source->stop();
             }
+            if (instance_->load_generator_) {
+                instance_->load_generator_->stop();
+            }
         }
     }
 }
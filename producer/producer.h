@@ -24,7 +24,9 @@
 #pragma once
 
 #include <memory>
+#include <atomic>
 #include <mutex>
+#include <thread>
 #include <vector>
 
 #include <nlohmann/json.hpp>
@@ -32,6 +34,11 @@
 #include "sensors/idata_source.h"
 #include "sensors/emulated/sensor_data_source.h"
 #include "can/ican_sender.h"
+#include "frame_batcher.h"
+#include "load_generator.h"
+#include "signal_packer.h"
+#include "metrics/metrics_exporter.h"
+#include "scheduling/timer_scheduler.h"
 
 
 class Producer
@@ -53,7 +60,15 @@ protected:
     static void signal_handler(int signum);
     bool setup_data_bindings();
     bool setup_can_senders();
+    std::shared_ptr<ICanSender> make_sender(const std::string& can_interface, const std::string& backend);
+    FrameBatcher::FlushPolicy flush_policy() const;
+    bool start_scheduler();
     bool setup_data_sending_callbacks();
+    bool start_load_generator(LoadGenerator::Options options);
+    bool start_signal_packer();
+    bool start_metrics();
+    bool start_trace();
+    void trace_worker(std::shared_ptr<ICanSender> sender, CanFrame frame, std::chrono::milliseconds period);
 
 private:
 
@@ -61,12 +76,22 @@ private:
         std::string data_source;
         std::string can_interface;
         uint32_t can_msg_id;
+        bool fd{false};     // pack readings into CAN-FD frames
+        bool brs{false};    // CAN-FD bit rate switch
+        std::chrono::microseconds period{0};    // 0: the sensor's default response time
     };
 
     nlohmann::json config_;
+    std::shared_ptr<TimerScheduler> scheduler_;
     std::vector<std::shared_ptr<IDataSource<SensorData>>> data_sources_;
+    std::unique_ptr<LoadGenerator> load_generator_;
+    std::unique_ptr<SignalPacker> signal_packer_;
     std::vector<DataBinding> bindings_;
     std::map<std::string, std::shared_ptr<ICanSender>> can_senders_;
+    std::map<std::string, std::shared_ptr<FrameBatcher>> tx_batchers_;
+    std::unique_ptr<MetricsExporter> metrics_exporter_;
+    std::thread trace_thread_;
+    std::atomic<bool> trace_running_{false};
 
     static std::shared_ptr<Producer> instance_;
 };
\ No newline at end of file
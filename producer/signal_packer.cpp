@@ -0,0 +1,220 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+#include "signal_packer.h"
+
+#include <algorithm>
+
+#include "logging/logger.h"
+
+
+static LogModule log_module("producer");
+
+SignalPacker::Options SignalPacker::parse_options(const nlohmann::json& config) {
+    Options options;
+    if (!config.value("enabled", true)) {
+        return options;
+    }
+
+    options.dbc = config.value("dbc", std::string{});
+    for (const auto& item : config.value("frames", nlohmann::json::array())) {
+        Frame frame;
+        frame.interface = item.value("interface", std::string{});
+        frame.message = item.value("message", std::string{});
+        frame.period = std::chrono::milliseconds(item.value("period_ms", frame.period.count()));
+        frame.brs = item.value("brs", frame.brs);
+        const auto signals = item.value("signals", nlohmann::json::object());
+        bool sources_valid = true;
+        for (const auto& [signal, source] : signals.items()) {
+            if (!source.is_string()) {
+                LOG_ERROR(log_module, "Packed frame {}: source of signal {} must be a sensor name, got {}",
+                          frame.message, signal, source.dump());
+                sources_valid = false;
+                break;
+            }
+            frame.signals.emplace_back(signal, source.get<std::string>());
+        }
+        if (!sources_valid) {
+            continue;
+        }
+
+        if (frame.interface.empty() || frame.message.empty() || frame.period.count() <= 0 || frame.signals.empty()) {
+            LOG_ERROR(log_module, "Invalid packed_frames entry, needs an interface, a message, a positive period_ms and signals");
+            continue;
+        }
+        options.frames.push_back(std::move(frame));
+    }
+
+    if (options.enabled() && options.dbc.empty()) {
+        LOG_ERROR(log_module, "packed_frames without a dbc file");
+        options.frames.clear();
+    }
+    return options;
+}
+
+SignalPacker::SignalPacker(Options options, std::shared_ptr<TimerScheduler> scheduler,
+                           const std::map<std::string, std::shared_ptr<FrameBatcher>>& batchers)
+    : options_(std::move(options))
+    , scheduler_(std::move(scheduler)) {
+    for (const auto& frame : options_.frames) {
+        auto state = std::make_unique<FrameState>();
+        state->frame = frame;
+        auto it = batchers.find(frame.interface);
+        if (it != batchers.end()) {
+            state->batcher = it->second;
+        }
+        frames_.push_back(std::move(state));
+    }
+}
+
+SignalPacker::~SignalPacker() {
+    stop();
+}
+
+bool SignalPacker::start() {
+    auto database = load_dbc_file(options_.dbc);
+    if (!database) {
+        LOG_ERROR(log_module, "Failed to load DBC file {}", options_.dbc);
+        return false;
+    }
+
+    for (size_t i = 0; i < frames_.size(); ++i) {
+        if (!resolve(*frames_[i], *database, i)) {
+            return false;
+        }
+    }
+    if (running_.exchange(true)) {
+        return false;
+    }
+
+    // Frames of the same period are spread over it instead of all leaving on the same tick
+    std::map<int64_t, size_t> per_period;
+    for (const auto& frame : frames_) {
+        ++per_period[frame->frame.period.count()];
+    }
+    std::map<int64_t, size_t> slot;
+    const auto now = TimerScheduler::Clock::now();
+    for (const auto& frame : frames_) {
+        auto* s = frame.get();
+        const auto period = s->frame.period;
+        const auto phase = period * slot[period.count()]++ / per_period[period.count()];
+        s->task = scheduler_->schedule([this, s]() { send(*s); }, period, now + phase);
+    }
+    return true;
+}
+
+bool SignalPacker::resolve(FrameState& state, const DbcDatabase& database, size_t index) {
+    const auto& frame = state.frame;
+    if (!state.batcher) {
+        LOG_ERROR(log_module, "Packed frame {}: interface {} not in can_interfaces", frame.message, frame.interface);
+        return false;
+    }
+
+    const DbcMessage* message = nullptr;
+    if (frame.message.starts_with("0x")) {
+        const auto id = parse_can_id(frame.message);
+        if (!id) {
+            LOG_ERROR(log_module, "Packed frame {}: not a CAN ID", frame.message);
+            return false;
+        }
+        message = database.find(*id, false);
+        if (!message) {
+            message = database.find(*id, true);
+        }
+    } else {
+        auto it = std::find_if(database.messages.begin(), database.messages.end(),
+                               [&](const DbcMessage& m) { return m.name == frame.message; });
+        message = it != database.messages.end() ? &*it : nullptr;
+    }
+    if (!message) {
+        LOG_ERROR(log_module, "Packed frame {}: message not in {}", frame.message, options_.dbc);
+        return false;
+    }
+
+    state.encoder = std::make_unique<DbcEncoder>(*message);
+    state.values = std::vector<std::atomic<double>>(message->signals.size());
+    state.scratch.resize(message->signals.size());
+    for (size_t s = 0; s < message->signals.size(); ++s) {
+        state.values[s].store(message->signals[s].offset);  // raw 0
+    }
+
+    for (const auto& [signal_name, source] : frame.signals) {
+        auto it = std::find_if(message->signals.begin(), message->signals.end(),
+                               [&](const DbcSignal& s) { return s.name == signal_name; });
+        if (it == message->signals.end()) {
+            LOG_ERROR(log_module, "Packed frame {}: no signal {}", message->name, signal_name);
+            return false;
+        }
+        if (it->mux == DbcSignal::Mux::Multiplexor) {
+            LOG_ERROR(log_module, "Packed frame {}: multiplexor {} is set by the packer, it takes no source", message->name, signal_name);
+            return false;
+        }
+        if (it->mux == DbcSignal::Mux::Multiplexed && std::find(state.pages.begin(), state.pages.end(), it->mux_value) == state.pages.end()) {
+            state.pages.push_back(it->mux_value);
+        }
+        sources_.push_back(Source{source, index, static_cast<size_t>(it - message->signals.begin())});
+    }
+    std::sort(state.pages.begin(), state.pages.end());
+    if (state.pages.empty()) {
+        state.pages.push_back(0);
+    }
+
+    const MetricLabels labels{{"interface", frame.interface}, {"message", message->name}};
+    auto& registry = MetricsRegistry::instance();
+    state.sent = &registry.counter("producer_packed_frames_total", "Packed signal frames queued for sending", labels);
+    state.failed = &registry.counter("producer_packed_frame_failures_total", "Packed signal frames that failed to send", labels);
+
+    LOG_INFO(log_module, "Packed frame {} (0x{:x}, {} bytes) on {} every {} ms: {} of {} signals{}",
+             message->name, message->id, unsigned{message->size}, frame.interface, frame.period.count(),
+             frame.signals.size(), message->signals.size(),
+             state.encoder->multiplexor() >= 0 ? ", " + std::to_string(state.pages.size()) + " multiplexed page(s)" : std::string{});
+    return true;
+}
+
+void SignalPacker::stop() {
+    if (!running_.exchange(false)) {
+        return;
+    }
+    for (const auto& frame : frames_) {
+        scheduler_->cancel(frame->task);
+    }
+}
+
+void SignalPacker::send(FrameState& state) {
+    for (size_t i = 0; i < state.scratch.size(); ++i) {
+        state.scratch[i] = state.values[i].load(std::memory_order_relaxed);
+    }
+
+    const uint32_t mux = state.pages[state.next_page];
+    state.next_page = (state.next_page + 1) % state.pages.size();
+
+    CanFrame frame;
+    state.encoder->encode(state.scratch, mux, frame);
+    frame.is_brs = frame.is_fd && state.frame.brs;
+
+    if (state.batcher->push(frame)) {
+        state.sent->add();
+    } else {
+        state.failed->add();
+        LOG_DEBUG(log_module, "Failed to send packed frame 0x{:x} on {}", frame.id, state.frame.interface);
+    }
+}
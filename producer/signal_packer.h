@@ -0,0 +1,115 @@
+/*
+ * <CAN MQTT IPC>
+ *
+ * Copyright (c) 2026 Cognizant.
+ * All Rights Reserved.
+ *
+ * This software and associated documentation files (the "Software")
+ * are the property of Cognizant.
+ *
+ * Permission is granted to use this Software solely in accordance
+ * with the terms of a valid license agreement with Cognizant.
+ *
+ * Redistribution, modification, sublicensing, or commercial use
+ * of this Software, in whole or in part, is prohibited except as
+ * expressly authorized in writing by Cognizant.
+ *
+ * This Software is provided "AS IS" without warranty of any kind,
+ * express or implied, including but not limited to the warranties
+ * of merchantability, fitness for a particular purpose, and
+ * non-infringement.
+ *
+ */
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "can/dbc/dbc_encoder.h"
+#include "frame_batcher.h"
+#include "metrics/metrics.h"
+#include "scheduling/timer_scheduler.h"
+
+
+// Cyclic frames that carry several sensors each, laid out by a DBC message. Sensor readings
+// only store the latest physical value of their signal; one scheduler task per frame encodes
+// all signals every period and queues the frame. Multiplexed messages send one multiplexor
+// page per period, cycling through the pages that have sources. Signals without a source, and
+// all signals until their first reading, are sent as raw 0.
+class SignalPacker
+{
+public:
+    struct Frame {
+        std::string interface;
+        std::string message;                        // DBC message name or "0x..." ID
+        std::chrono::milliseconds period{100};
+        bool brs{false};                            // messages longer than 8 bytes go out as FD frames
+        std::vector<std::pair<std::string, std::string>> signals;  // DBC signal -> data source
+    };
+
+    struct Options {
+        std::string dbc;
+        std::vector<Frame> frames;
+
+        bool enabled() const { return !frames.empty(); }
+    };
+
+    // A data source feeding one packed signal
+    struct Source {
+        std::string name;
+        size_t frame;
+        size_t signal;
+    };
+
+    // Reads the "producer.packed_frames" object, invalid frames are logged and left out.
+    // "enabled": false yields no frames.
+    static Options parse_options(const nlohmann::json& config);
+
+    SignalPacker(Options options, std::shared_ptr<TimerScheduler> scheduler,
+                 const std::map<std::string, std::shared_ptr<FrameBatcher>>& batchers);
+    ~SignalPacker();
+
+    // Loads the DBC, resolves messages and signals and schedules the frames
+    bool start();
+    void stop();
+
+    // Sources to start once start() succeeded
+    const std::vector<Source>& sources() const { return sources_; }
+
+    // Called from the sensor tasks, never blocks
+    void update(const Source& source, double value)
+    {
+        frames_[source.frame]->values[source.signal].store(value, std::memory_order_relaxed);
+    }
+
+private:
+    struct FrameState {
+        Frame frame;
+        std::shared_ptr<FrameBatcher> batcher;
+        std::unique_ptr<DbcEncoder> encoder;
+        std::vector<std::atomic<double>> values;    // latest reading per signal
+        std::vector<double> scratch;                // send task only
+        std::vector<uint32_t> pages;                // multiplexor values to cycle through
+        size_t next_page{0};
+        Counter* sent{nullptr};
+        Counter* failed{nullptr};
+        TimerScheduler::TaskId task{0};
+    };
+
+    bool resolve(FrameState& state, const DbcDatabase& database, size_t index);
+    void send(FrameState& state);
+
+private:
+    Options options_;
+    std::shared_ptr<TimerScheduler> scheduler_;
+    std::vector<std::unique_ptr<FrameState>> frames_;
+    std::vector<Source> sources_;
+    std::atomic<bool> running_{false};
+};